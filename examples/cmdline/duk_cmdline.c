@@ -285,6 +285,7 @@ static duk_ret_t wrapped_compile_execute(duk_context *ctx, void *udata) {
 
 	duk_push_global_object(ctx);  /* 'this' binding */
 	duk_call_method(ctx, 0);
+	duk_run_jobs(ctx);  /* Promise jobs queued by the script */
 
 #if defined(DUK_CMDLINE_LOWMEM)
 	lowmem_clear_exec_timeout();
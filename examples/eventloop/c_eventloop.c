@@ -189,6 +189,7 @@ static void expire_timers(duk_context *ctx) {
 #endif
 		}
 		duk_pop(ctx);    /* ignore errors for now -> [ ... stash eventTimers ] */
+		duk_run_jobs(ctx);  /* Promise jobs queued by the callback */
 
 		if (t->removed) {
 			/* One-shot timer (always removed) or removed by user callback. */
@@ -390,6 +391,7 @@ duk_ret_t eventloop_run(duk_context *ctx, void *udata) {
 #endif
 				}
 				duk_pop(ctx);
+				duk_run_jobs(ctx);  /* Promise jobs queued by the callback */
 
 				pfd->revents = 0;
 			}
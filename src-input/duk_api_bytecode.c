@@ -439,7 +439,8 @@ static const duk_uint8_t *duk__load_func(duk_hthread *thr, const duk_uint8_t *p,
 
 	/* duk_hcompfunc flags; quite version specific */
 	tmp32 = DUK_RAW_READINC_U32_BE(p);
-	DUK_HEAPHDR_SET_FLAGS((duk_heaphdr *) h_fun, tmp32);  /* masks flags to only change duk_hobject flags */
+	h_fun->obj.hdr.h_flags = (h_fun->obj.hdr.h_flags & ~DUK_HEAPHDR_FLAGS_USER_MASK) |
+	                         (tmp32 & DUK_HEAPHDR_FLAGS_USER_MASK);  /* only change duk_hobject flags, GC flags are our own */
 
 	/* standard prototype (no need to set here, already set) */
 	DUK_ASSERT(DUK_HOBJECT_GET_PROTOTYPE(thr->heap, (duk_hobject *) h_fun) == thr->builtins[DUK_BIDX_FUNCTION_PROTOTYPE]);
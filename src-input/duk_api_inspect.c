@@ -126,6 +126,10 @@ DUK_EXTERNAL void duk_inspect_value(duk_hthread *thr, duk_idx_t idx) {
 		} else if (DUK_HOBJECT_IS_BUFOBJ(h_obj)) {
 			vals[DUK__IDX_HBYTES] = sizeof(duk_hbufobj);
 			/* XXX: some size information */
+#endif
+#if defined(DUK_USE_MAP_BUILTIN)
+		} else if (DUK_HOBJECT_IS_HMAP(h_obj)) {
+			vals[DUK__IDX_HBYTES] = sizeof(duk_hmap);
 #endif
 		} else {
 			vals[DUK__IDX_HBYTES] = (duk_small_uint_t) sizeof(duk_hobject);
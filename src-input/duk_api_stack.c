@@ -5256,6 +5256,31 @@ DUK_INTERNAL duk_hbufobj *duk_push_bufobj_raw(duk_hthread *thr, duk_uint_t hobje
 }
 #endif  /* DUK_USE_BUFFEROBJECT_SUPPORT */
 
+#if defined(DUK_USE_MAP_BUILTIN)
+DUK_INTERNAL duk_hmap *duk_push_hmap_raw(duk_hthread *thr, duk_uint_t hobject_flags_and_class, duk_small_int_t prototype_bidx) {
+	duk_hmap *obj;
+	duk_tval *tv_slot;
+
+	DUK_ASSERT_API_ENTRY(thr);
+	DUK_ASSERT(prototype_bidx >= 0);
+
+	DUK__CHECK_SPACE();
+
+	obj = duk_hmap_alloc(thr, hobject_flags_and_class);
+	DUK_ASSERT(obj != NULL);
+
+	DUK_HOBJECT_SET_PROTOTYPE_INIT_INCREF(thr, (duk_hobject *) obj, thr->builtins[prototype_bidx]);
+	DUK_HMAP_ASSERT_VALID(obj);
+
+	tv_slot = thr->valstack_top;
+	DUK_TVAL_SET_OBJECT(tv_slot, (duk_hobject *) obj);
+	DUK_HOBJECT_INCREF(thr, obj);
+	thr->valstack_top++;
+
+	return obj;
+}
+#endif  /* DUK_USE_MAP_BUILTIN */
+
 /* XXX: There's quite a bit of overlap with buffer creation handling in
  * duk_bi_buffer.c.  Look for overlap and refactor.
  */
@@ -261,6 +261,11 @@ DUK_EXTERNAL void duk_substring(duk_hthread *thr, duk_idx_t idx, duk_size_t star
 	DUK_ASSERT(start_offset <= DUK_UINT32_MAX);
 	DUK_ASSERT(end_offset <= DUK_UINT32_MAX);
 
+	if (start_offset == 0 && end_offset == charlen) {
+		DUK_DDD(DUK_DDDPRINT("substring covers whole input: avoid interning (copying, hashing etc)"));
+		return;
+	}
+
 	start_byte_offset = (duk_size_t) duk_heap_strcache_offset_char2byte(thr, h, (duk_uint_fast32_t) start_offset);
 	end_byte_offset = (duk_size_t) duk_heap_strcache_offset_char2byte(thr, h, (duk_uint_fast32_t) end_offset);
 
@@ -136,6 +136,25 @@ DUK_LOCAL duk_harray *duk__arraypart_fastpath_this(duk_hthread *thr) {
 	DUK_DD(DUK_DDPRINT("array fast path allowed for: %!O", (duk_heaphdr *) h));
 	return (duk_harray *) h;
 }
+
+/* Like duk__arraypart_fastpath_this(), but also require that 'length' is
+ * writable and the Array is extensible.  Fast paths which move elements
+ * around may turn gaps into elements and must update 'length', so they
+ * can then skip the checks the property code would do for each write.
+ */
+DUK_LOCAL duk_harray *duk__arraypart_fastpath_this_writable(duk_hthread *thr) {
+	duk_harray *h_arr;
+
+	h_arr = duk__arraypart_fastpath_this(thr);
+	if (h_arr == NULL) {
+		return NULL;
+	}
+	if (DUK_HARRAY_LENGTH_NONWRITABLE(h_arr) || !DUK_HOBJECT_HAS_EXTENSIBLE((duk_hobject *) h_arr)) {
+		DUK_DD(DUK_DDPRINT("reject array fast path: length not writable or not extensible"));
+		return NULL;
+	}
+	return h_arr;
+}
 #endif  /* DUK_USE_ARRAY_FASTPATH */
 
 /*
@@ -361,7 +380,183 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_concat(duk_hthread *thr) {
  *  elements to join must be handled here and have special handling.  Current
  *  approach is to do intermediate joins with very large number of elements.
  *  There is no fancy handling; the prefix gets re-joined multiple times.
+ *
+ *  join() on a dense Array whose elements are strings, small integers, or
+ *  other values with a side effect free ToString() uses a two pass fast path
+ *  instead: compute the result length, then write the result directly.
+ */
+
+#if defined(DUK_USE_ARRAY_FASTPATH)
+/* Get the ToString() coercion of an Array element for the join() fast path
+ * when it can be computed without side effects: for non-Symbol strings,
+ * booleans, null/undefined, and integers in the 32-bit range.  Returns 0
+ * for any other value, including gaps which may inherit a value.  'tmp' is
+ * used to format numbers and must have room for DUK__JOIN_TMP_SIZE bytes.
  */
+#define DUK__JOIN_TMP_SIZE  11  /* "-4294967295" */
+
+DUK_LOCAL duk_bool_t duk__array_join_elem(duk_tval *tv, duk_uint8_t *tmp, const duk_uint8_t **out_data, duk_size_t *out_len) {
+	switch (DUK_TVAL_GET_TAG(tv)) {
+	case DUK_TAG_UNDEFINED:
+	case DUK_TAG_NULL: {
+		*out_data = NULL;
+		*out_len = 0;
+		return 1;
+	}
+	case DUK_TAG_BOOLEAN: {
+		if (DUK_TVAL_GET_BOOLEAN(tv)) {
+			*out_data = (const duk_uint8_t *) "true";
+			*out_len = 4;
+		} else {
+			*out_data = (const duk_uint8_t *) "false";
+			*out_len = 5;
+		}
+		return 1;
+	}
+	case DUK_TAG_STRING: {
+		duk_hstring *h = DUK_TVAL_GET_STRING(tv);
+		DUK_ASSERT(h != NULL);
+		if (DUK_UNLIKELY(DUK_HSTRING_HAS_SYMBOL(h))) {
+			return 0;
+		}
+		*out_data = (const duk_uint8_t *) DUK_HSTRING_GET_DATA(h);
+		*out_len = (duk_size_t) DUK_HSTRING_GET_BYTELEN(h);
+		return 1;
+	}
+	default: {
+		duk_double_t d;
+		duk_uint32_t uval;
+		duk_uint8_t *p;
+		duk_bool_t neg;
+
+		if (!DUK_TVAL_IS_NUMBER(tv)) {
+			return 0;
+		}
+
+		/* Integers in the 32-bit range format as plain digits,
+		 * which matches duk_numconv_stringify() output.  Negative
+		 * zero formats as "0".
+		 */
+		d = DUK_TVAL_GET_NUMBER(tv);
+		neg = (d < 0.0);
+		if (neg) {
+			d = -d;
+		}
+		uval = duk_double_to_uint32_t(d);
+		if (!duk_double_equals((duk_double_t) uval, d)) {
+			return 0;
+		}
+		p = tmp + DUK__JOIN_TMP_SIZE;
+		do {
+			*(--p) = (duk_uint8_t) ('0' + (uval % 10U));
+			uval /= 10U;
+		} while (uval != 0U);
+		if (neg) {
+			*(--p) = (duk_uint8_t) '-';
+		}
+		DUK_ASSERT(p >= tmp);
+		*out_data = (const duk_uint8_t *) p;
+		*out_len = (duk_size_t) ((tmp + DUK__JOIN_TMP_SIZE) - p);
+		return 1;
+	}
+	}
+}
+
+/* Two pass join() for dense Arrays: first compute the result length and
+ * then write the result into a fixed buffer which is interned once.  This
+ * avoids pushing a string for each element and the repeated intermediate
+ * joins of the generic path.  If any element needs a full ToString()
+ * coercion, return 0 without side effects and let the caller use the
+ * generic path.
+ */
+DUK_LOCAL duk_bool_t duk__array_join_fastpath(duk_hthread *thr, duk_uint32_t len) {
+	duk_harray *h_arr;
+	duk_hstring *h_sep;
+	duk_tval *tv_base;
+	duk_uint8_t tmp[DUK__JOIN_TMP_SIZE];
+	const duk_uint8_t *data;
+	duk_size_t data_len;
+	duk_size_t sep_len;
+	duk_size_t total;
+	duk_uint8_t *buf;
+	duk_uint8_t *p;
+	duk_uint8_t *p_end;
+	duk_uint32_t i;
+
+	/* [ sep ToObject(this) len ] */
+
+	h_arr = duk__arraypart_fastpath_this(thr);
+	if (h_arr == NULL || h_arr->length != len) {
+		return 0;
+	}
+	h_sep = duk_known_hstring(thr, 0);
+	sep_len = (duk_size_t) DUK_HSTRING_GET_BYTELEN(h_sep);
+
+	/* First pass: check that all elements can be handled and compute
+	 * the result length.  Each component is at most the maximum string
+	 * length so checking after each addition is enough to avoid wrapping.
+	 */
+	tv_base = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+	total = 0;
+	for (i = 0; i < len; i++) {
+		if (!duk__array_join_elem(tv_base + i, tmp, &data, &data_len)) {
+			DUK_DD(DUK_DDPRINT("reject join fast path: element %ld needs coercion", (long) i));
+			return 0;
+		}
+		if (i > 0) {
+			total += sep_len;
+		}
+		total += data_len;
+		if (total > (duk_size_t) DUK_HSTRING_MAX_BYTELEN) {
+			/* Let the generic path throw. */
+			return 0;
+		}
+	}
+
+	/* Buffer allocation may trigger a GC which may run finalizers and
+	 * resize or abandon the array part, so re-check the fast path
+	 * conditions and bounds check the second pass.
+	 */
+	buf = (duk_uint8_t *) duk_push_fixed_buffer_nozero(thr, total);
+	h_arr = duk__arraypart_fastpath_this(thr);
+	if (h_arr == NULL || h_arr->length != len) {
+		goto fail_pop;
+	}
+	tv_base = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+
+	/* Second pass: write the result. */
+	p = buf;
+	p_end = buf + total;
+	for (i = 0; i < len; i++) {
+		if (i > 0) {
+			if ((duk_size_t) (p_end - p) < sep_len) {
+				goto fail_pop;
+			}
+			duk_memcpy_unsafe((void *) p, (const void *) DUK_HSTRING_GET_DATA(h_sep), sep_len);
+			p += sep_len;
+		}
+		if (!duk__array_join_elem(tv_base + i, tmp, &data, &data_len) ||
+		    (duk_size_t) (p_end - p) < data_len) {
+			goto fail_pop;
+		}
+		duk_memcpy_unsafe((void *) p, (const void *) data, data_len);
+		p += data_len;
+	}
+	if (p != p_end) {
+		goto fail_pop;
+	}
+
+	/* [ sep ToObject(this) len buf ] */
+
+	(void) duk_buffer_to_string(thr, -1);  /* Safe if inputs are safe. */
+	return 1;
+
+ fail_pop:
+	DUK_DD(DUK_DDPRINT("join fast path conditions changed during buffer allocation"));
+	duk_pop(thr);
+	return 0;
+}
+#endif  /* DUK_USE_ARRAY_FASTPATH */
 
 DUK_INTERNAL duk_ret_t duk_bi_array_prototype_join_shared(duk_hthread *thr) {
 	duk_uint32_t len, count;
@@ -390,6 +585,13 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_join_shared(duk_hthread *thr) {
 	                     (duk_tval *) duk_get_tval(thr, 1),
 	                     (unsigned long) len));
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	if (!to_locale_string && duk__array_join_fastpath(thr, len)) {
+		/* [ sep ToObject(this) len result ] */
+		return 1;
+	}
+#endif
+
 	/* The extra (+4) is tight. */
 	valstack_required = (duk_idx_t) ((len >= DUK__ARRAY_MID_JOIN_LIMIT ?
 	                                  DUK__ARRAY_MID_JOIN_LIMIT : len) + 4);
@@ -629,92 +831,83 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_push(duk_hthread *thr) {
 /*
  *  sort()
  *
- *  Currently qsort with random pivot.  This is now really, really slow,
- *  because there is no fast path for array parts.
+ *  Stable merge sort following the TimSort structure: natural runs are
+ *  detected (strictly descending runs are reversed in place), short runs
+ *  are extended to a minimum length using binary insertion sort, and runs
+ *  are merged using a run stack which maintains the TimSort invariants.
+ *  Galloping mode is not implemented.
  *
- *  Signed indices are used because qsort() leaves and degenerate cases
- *  may use a negative offset.
+ *  As in ES2019 SortIndexedProperties(), present values are first read
+ *  into a temporary array, sorted, and then written back, followed by
+ *  deleting the remaining indices (the holes).  Undefined values always
+ *  sort last so they are just counted.  The sort itself operates on a
+ *  permutation of indices into the temporary array, kept in a fixed buffer
+ *  which never moves, so a compare function with arbitrary side effects
+ *  cannot corrupt the sort state.
+ *
+ *  Without a compare function values are compared as strings.  Strings,
+ *  numbers, booleans, and null are ToString() coerced once into a key
+ *  array before sorting, which makes sorting e.g. all-number arrays cheap.
+ *  Other values are coerced for each comparison because the coercion may
+ *  have side effects (or throw, e.g. for symbols).
+ *
+ *  For dense Arrays the values are read from and written back to the array
+ *  part directly.
  */
 
-DUK_LOCAL duk_small_int_t duk__array_sort_compare(duk_hthread *thr, duk_int_t idx1, duk_int_t idx2) {
-	duk_bool_t have1, have2;
-	duk_bool_t undef1, undef2;
-	duk_small_int_t ret;
-	duk_idx_t idx_obj = 1;  /* fixed offsets in valstack */
-	duk_idx_t idx_fn = 0;
-	duk_hstring *h1, *h2;
+/* Runs shorter than this are extended using binary insertion sort. */
+#define DUK__SORT_MIN_MERGE  32
 
-	/* Fast exit if indices are identical.  This is valid for a non-existent property,
-	 * for an undefined value, and almost always for ToString() coerced comparison of
-	 * arbitrary values (corner cases where this is not the case include e.g. a an
-	 * object with varying ToString() coercion).
-	 *
-	 * The specification does not prohibit "caching" of values read from the array, so
-	 * assuming equality for comparing an index with itself falls into the category of
-	 * "caching".
-	 *
-	 * Also, compareFn may be inconsistent, so skipping a call to compareFn here may
-	 * have an effect on the final result.  The specification does not require any
-	 * specific behavior for inconsistent compare functions, so again, this fast path
-	 * is OK.
-	 */
-
-	if (idx1 == idx2) {
-		DUK_DDD(DUK_DDDPRINT("duk__array_sort_compare: idx1=%ld, idx2=%ld -> indices identical, quick exit",
-		                     (long) idx1, (long) idx2));
-		return 0;
-	}
-
-	have1 = duk_get_prop_index(thr, idx_obj, (duk_uarridx_t) idx1);
-	have2 = duk_get_prop_index(thr, idx_obj, (duk_uarridx_t) idx2);
-
-	DUK_DDD(DUK_DDDPRINT("duk__array_sort_compare: idx1=%ld, idx2=%ld, have1=%ld, have2=%ld, val1=%!T, val2=%!T",
-	                     (long) idx1, (long) idx2, (long) have1, (long) have2,
-	                     (duk_tval *) duk_get_tval(thr, -2), (duk_tval *) duk_get_tval(thr, -1)));
+/* Run stack size: the TimSort invariants ensure run lengths grow at least
+ * as fast as the Fibonacci sequence, so this is plenty for 32-bit lengths.
+ */
+#define DUK__SORT_MAX_RUNS   64
+
+/* Fixed value stack offsets. */
+#define DUK__SORT_IDX_FN      0
+#define DUK__SORT_IDX_OBJ     1
+#define DUK__SORT_IDX_VALUES  3
+#define DUK__SORT_IDX_KEYS    4
+
+typedef struct {
+	duk_hthread *thr;
+	duk_hobject *h_values;    /* values being sorted, reachable via value stack */
+	duk_hobject *h_keys;      /* ToString() coerced keys or NULL */
+	duk_uint32_t *perm;       /* permutation being sorted */
+	duk_uint32_t *scratch;    /* merge temporary, same size as 'perm' */
+	duk_uint32_t run_base[DUK__SORT_MAX_RUNS];
+	duk_uint32_t run_len[DUK__SORT_MAX_RUNS];
+	duk_uint_t num_runs;
+} duk__array_sort_ctx;
+
+/* Compare values[i1] and values[i2], return <0, 0, or >0 like SortCompare()
+ * for non-undefined values.
+ */
+DUK_LOCAL duk_small_int_t duk__array_sort_compare(duk__array_sort_ctx *ctx, duk_uint32_t i1, duk_uint32_t i2) {
+	duk_hthread *thr;
+	duk_tval *tv_values;
+	duk_tval *tv_keys;
+	duk_tval *tv1;
+	duk_tval *tv2;
+	duk_hstring *h1, *h2;
+	duk_small_int_t ret;
 
-	if (have1) {
-		if (have2) {
-			;
-		} else {
-			ret = -1;
-			goto pop_ret;
-		}
-	} else {
-		if (have2) {
-			ret = 1;
-			goto pop_ret;
-		} else {
-			ret = 0;
-			goto pop_ret;
-		}
-	}
+	thr = ctx->thr;
 
-	undef1 = duk_is_undefined(thr, -2);
-	undef2 = duk_is_undefined(thr, -1);
-	if (undef1) {
-		if (undef2) {
-			ret = 0;
-			goto pop_ret;
-		} else {
-			ret = 1;
-			goto pop_ret;
-		}
-	} else {
-		if (undef2) {
-			ret = -1;
-			goto pop_ret;
-		} else {
-			;
-		}
-	}
+	/* Array part base pointers are looked up for every comparison:
+	 * a compare function or a ToString() coercion may trigger a GC
+	 * which may reallocate the array parts.
+	 */
+	tv_values = DUK_HOBJECT_A_GET_BASE(thr->heap, ctx->h_values);
 
-	if (!duk_is_undefined(thr, idx_fn)) {
+	if (ctx->h_keys == NULL) {
 		duk_double_t d;
 
 		/* No need to check callable; duk_call() will do that. */
-		duk_dup(thr, idx_fn);    /* -> [ ... x y fn ] */
-		duk_insert(thr, -3);     /* -> [ ... fn x y ] */
-		duk_call(thr, 2);        /* -> [ ... res ] */
+		duk_dup(thr, DUK__SORT_IDX_FN);
+		duk_push_tval(thr, tv_values + i1);
+		duk_push_tval(thr, tv_values + i2);
+		duk_call(thr, 2);
 
 		/* ES5 is a bit vague about what to do if the return value is
 		 * not a number.  ES2015 provides a concrete description:
@@ -734,203 +927,430 @@ DUK_LOCAL duk_small_int_t duk__array_sort_compare(duk_hthread *thr, duk_int_t id
 		}
 
 		duk_pop_nodecref_unsafe(thr);
-		DUK_DDD(DUK_DDDPRINT("-> result %ld (from comparefn, after coercion)", (long) ret));
 		return ret;
 	}
 
-	/* string compare is the default (a bit oddly) */
+	/* String compare is the default (a bit oddly).  Use the precomputed
+	 * keys when available.
+	 */
+	tv_keys = DUK_HOBJECT_A_GET_BASE(thr->heap, ctx->h_keys);
+	tv1 = tv_keys + i1;
+	tv2 = tv_keys + i2;
+	if (DUK_LIKELY(DUK_TVAL_IS_STRING(tv1) && DUK_TVAL_IS_STRING(tv2))) {
+		return duk_js_string_compare(DUK_TVAL_GET_STRING(tv1), DUK_TVAL_GET_STRING(tv2));
+	}
 
-	/* XXX: any special handling for plain array; causes repeated coercion now? */
+	duk_push_tval(thr, DUK_TVAL_IS_STRING(tv1) ? tv1 : tv_values + i1);
+	duk_push_tval(thr, DUK_TVAL_IS_STRING(tv2) ? tv2 : tv_values + i2);
 	h1 = duk_to_hstring(thr, -2);
 	h2 = duk_to_hstring_m1(thr);
 	DUK_ASSERT(h1 != NULL);
 	DUK_ASSERT(h2 != NULL);
-
 	ret = duk_js_string_compare(h1, h2);  /* retval is directly usable */
-	goto pop_ret;
-
- pop_ret:
 	duk_pop_2_unsafe(thr);
-	DUK_DDD(DUK_DDDPRINT("-> result %ld", (long) ret));
 	return ret;
 }
 
-DUK_LOCAL void duk__array_sort_swap(duk_hthread *thr, duk_int_t l, duk_int_t r) {
-	duk_bool_t have_l, have_r;
-	duk_idx_t idx_obj = 1;  /* fixed offset in valstack */
+/* Sort perm[lo,hi[ using binary insertion, perm[lo,start[ is already sorted. */
+DUK_LOCAL void duk__array_sort_insertion(duk__array_sort_ctx *ctx, duk_uint32_t lo, duk_uint32_t hi, duk_uint32_t start) {
+	duk_uint32_t *perm = ctx->perm;
+	duk_uint32_t pivot;
+	duk_uint32_t l, r, m;
 
-	if (l == r) {
-		return;
-	}
+	DUK_ASSERT(lo < start && start <= hi);
 
-	/* swap elements; deal with non-existent elements correctly */
-	have_l = duk_get_prop_index(thr, idx_obj, (duk_uarridx_t) l);
-	have_r = duk_get_prop_index(thr, idx_obj, (duk_uarridx_t) r);
+	for (; start < hi; start++) {
+		pivot = perm[start];
 
-	if (have_r) {
-		/* right exists, [[Put]] regardless whether or not left exists */
-		duk_put_prop_index(thr, idx_obj, (duk_uarridx_t) l);
-	} else {
-		duk_del_prop_index(thr, idx_obj, (duk_uarridx_t) l);
-		duk_pop_undefined(thr);
+		/* Find the rightmost insertion point to keep the sort stable. */
+		l = lo;
+		r = start;
+		while (l < r) {
+			m = l + (r - l) / 2;
+			if (duk__array_sort_compare(ctx, pivot, perm[m]) < 0) {
+				r = m;
+			} else {
+				l = m + 1;
+			}
+		}
+
+		duk_memmove((void *) (perm + l + 1), (const void *) (perm + l), (duk_size_t) (start - l) * sizeof(duk_uint32_t));
+		perm[l] = pivot;
 	}
+}
+
+/* Return the length of the run starting at 'lo', reversing it if it is
+ * strictly descending (reversing a non-strictly descending run would not
+ * be stable).
+ */
+DUK_LOCAL duk_uint32_t duk__array_sort_count_run(duk__array_sort_ctx *ctx, duk_uint32_t lo, duk_uint32_t hi) {
+	duk_uint32_t *perm = ctx->perm;
+	duk_uint32_t i;
+	duk_uint32_t l, r, t;
 
-	if (have_l) {
-		duk_put_prop_index(thr, idx_obj, (duk_uarridx_t) r);
+	DUK_ASSERT(lo < hi);
+
+	i = lo + 1;
+	if (i == hi) {
+		return 1;
+	}
+	if (duk__array_sort_compare(ctx, perm[i], perm[lo]) < 0) {
+		for (i++; i < hi && duk__array_sort_compare(ctx, perm[i], perm[i - 1]) < 0; i++) {
+			;
+		}
+		for (l = lo, r = i - 1; l < r; l++, r--) {
+			t = perm[l];
+			perm[l] = perm[r];
+			perm[r] = t;
+		}
 	} else {
-		duk_del_prop_index(thr, idx_obj, (duk_uarridx_t) r);
-		duk_pop_undefined(thr);
+		for (i++; i < hi && duk__array_sort_compare(ctx, perm[i], perm[i - 1]) >= 0; i++) {
+			;
+		}
 	}
+	return i - lo;
 }
 
-#if defined(DUK_USE_DEBUG_LEVEL) && (DUK_USE_DEBUG_LEVEL >= 2)
-/* Debug print which visualizes the qsort partitioning process. */
-DUK_LOCAL void duk__debuglog_qsort_state(duk_hthread *thr, duk_int_t lo, duk_int_t hi, duk_int_t pivot) {
-	char buf[4096];
-	char *ptr = buf;
-	duk_int_t i, n;
-	n = (duk_int_t) duk_get_length(thr, 1);
-	if (n > 4000) {
-		n = 4000;
+/* Merge runs at stack positions k and k + 1. */
+DUK_LOCAL void duk__array_sort_merge_at(duk__array_sort_ctx *ctx, duk_uint_t k) {
+	duk_uint32_t *perm = ctx->perm;
+	duk_uint32_t *scratch = ctx->scratch;
+	duk_uint32_t base_a, len_a, len_b;
+	duk_uint32_t i, j, end_b, dst;
+
+	DUK_ASSERT(ctx->num_runs >= 2);
+	DUK_ASSERT(k == ctx->num_runs - 2 || k == ctx->num_runs - 3);
+
+	base_a = ctx->run_base[k];
+	len_a = ctx->run_len[k];
+	len_b = ctx->run_len[k + 1];
+	DUK_ASSERT(base_a + len_a == ctx->run_base[k + 1]);
+
+	ctx->run_len[k] = len_a + len_b;
+	if (k == ctx->num_runs - 3) {
+		ctx->run_base[k + 1] = ctx->run_base[k + 2];
+		ctx->run_len[k + 1] = ctx->run_len[k + 2];
 	}
-	*ptr++ = '[';
-	for (i = 0; i < n; i++) {
-		if (i == pivot) {
-			*ptr++ = '|';
-		} else if (i == lo) {
-			*ptr++ = '<';
-		} else if (i == hi) {
-			*ptr++ = '>';
-		} else if (i >= lo && i <= hi) {
-			*ptr++ = '-';
+	ctx->num_runs--;
+
+	/* Nothing to do if the runs are already in order, common for
+	 * partially sorted input.
+	 */
+	j = base_a + len_a;
+	if (duk__array_sort_compare(ctx, perm[j], perm[j - 1]) >= 0) {
+		return;
+	}
+
+	/* Merge forwards from a copy of the first run; on ties the first
+	 * run wins which keeps the sort stable.
+	 */
+	duk_memcpy((void *) scratch, (const void *) (perm + base_a), (duk_size_t) len_a * sizeof(duk_uint32_t));
+	i = 0;
+	end_b = j + len_b;
+	dst = base_a;
+	while (i < len_a && j < end_b) {
+		if (duk__array_sort_compare(ctx, perm[j], scratch[i]) < 0) {
+			perm[dst++] = perm[j++];
 		} else {
-			*ptr++ = ' ';
+			perm[dst++] = scratch[i++];
 		}
 	}
-	*ptr++ = ']';
-	*ptr++ = '\0';
-
-	DUK_DDD(DUK_DDDPRINT("%s   (lo=%ld, hi=%ld, pivot=%ld)",
-	                     (const char *) buf, (long) lo, (long) hi, (long) pivot));
+	while (i < len_a) {
+		perm[dst++] = scratch[i++];
+	}
+	DUK_ASSERT(dst == j);
 }
-#endif
 
-DUK_LOCAL void duk__array_qsort(duk_hthread *thr, duk_int_t lo, duk_int_t hi) {
-	duk_int_t p, l, r;
+DUK_LOCAL void duk__array_sort_merge_collapse(duk__array_sort_ctx *ctx) {
+	duk_uint32_t *run_len = ctx->run_len;
+	duk_uint_t k;
 
-	/* The lo/hi indices may be crossed and hi < 0 is possible at entry. */
+	while (ctx->num_runs > 1) {
+		k = ctx->num_runs - 2;
+		if ((k > 0 && run_len[k - 1] <= run_len[k] + run_len[k + 1]) ||
+		    (k > 1 && run_len[k - 2] <= run_len[k - 1] + run_len[k])) {
+			if (run_len[k - 1] < run_len[k + 1]) {
+				k--;
+			}
+		} else if (run_len[k] > run_len[k + 1]) {
+			break;
+		}
+		duk__array_sort_merge_at(ctx, k);
+	}
+}
 
-	DUK_DDD(DUK_DDDPRINT("duk__array_qsort: lo=%ld, hi=%ld, obj=%!T",
-	                     (long) lo, (long) hi, (duk_tval *) duk_get_tval(thr, 1)));
+DUK_LOCAL void duk__array_sort_perm(duk__array_sort_ctx *ctx, duk_uint32_t n) {
+	duk_uint32_t minrun;
+	duk_uint32_t lo;
+	duk_uint32_t run;
+	duk_uint32_t forced;
+	duk_uint32_t t;
+	duk_uint_t k;
 
-	DUK_ASSERT_TOP(thr, 3);
+	if (n < 2) {
+		return;
+	}
 
-	/* In some cases it may be that lo > hi, or hi < 0; these
-	 * degenerate cases happen e.g. for empty arrays, and in
-	 * recursion leaves.
+	/* Minimum run length, chosen so that n / minrun is a power of two
+	 * or slightly less, for balanced merges.
 	 */
+	minrun = n;
+	t = 0;
+	while (minrun >= DUK__SORT_MIN_MERGE) {
+		t |= minrun & 1U;
+		minrun >>= 1;
+	}
+	minrun += t;
+
+	ctx->num_runs = 0;
+	for (lo = 0; lo < n; lo += run) {
+		run = duk__array_sort_count_run(ctx, lo, n);
+		if (run < minrun) {
+			forced = (n - lo < minrun ? n - lo : minrun);
+			duk__array_sort_insertion(ctx, lo, lo + forced, lo + run);
+			run = forced;
+		}
 
-	/* trivial cases */
-	if (hi - lo < 1) {
-		DUK_DDD(DUK_DDDPRINT("degenerate case, return immediately"));
-		return;
+		DUK_ASSERT(ctx->num_runs < DUK__SORT_MAX_RUNS);
+		ctx->run_base[ctx->num_runs] = lo;
+		ctx->run_len[ctx->num_runs] = run;
+		ctx->num_runs++;
+		duk__array_sort_merge_collapse(ctx);
+	}
+
+	while (ctx->num_runs > 1) {
+		k = ctx->num_runs - 2;
+		if (k > 0 && ctx->run_len[k - 1] < ctx->run_len[k + 1]) {
+			k--;
+		}
+		duk__array_sort_merge_at(ctx, k);
 	}
-	DUK_ASSERT(hi > lo);
-	DUK_ASSERT(hi - lo + 1 >= 2);
+	DUK_ASSERT(ctx->num_runs == 1 && ctx->run_len[0] == n);
+}
 
-	/* randomized pivot selection */
-	p = lo + (duk_int_t) (DUK_UTIL_GET_RANDOM_DOUBLE(thr) * (duk_double_t) (hi - lo + 1));
-	DUK_ASSERT(p >= lo && p <= hi);
-	DUK_DDD(DUK_DDDPRINT("lo=%ld, hi=%ld, chose pivot p=%ld", (long) lo, (long) hi, (long) p));
+#if defined(DUK_USE_ARRAY_FASTPATH)
+/* Push the non-undefined values of a dense Array without gaps into a new
+ * temporary array.  Returns the number of values, or -1 (with nothing
+ * pushed) if the fast path doesn't apply.
+ */
+DUK_LOCAL duk_int_t duk__array_sort_read_fastpath(duk_hthread *thr, duk_uint32_t len) {
+	duk_harray *h_arr;
+	duk_tval *tv_src;
+	duk_tval *tv_dst;
+	duk_uint32_t i, n, left;
 
-	/* move pivot out of the way */
-	duk__array_sort_swap(thr, p, lo);
-	p = lo;
-	DUK_DDD(DUK_DDDPRINT("pivot moved out of the way: %!T", (duk_tval *) duk_get_tval(thr, 1)));
+	h_arr = duk__arraypart_fastpath_this(thr);
+	if (h_arr == NULL || h_arr->length != len) {
+		return -1;
+	}
+	tv_src = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+	for (i = 0, n = 0; i < len; i++) {
+		if (DUK_TVAL_IS_UNUSED(tv_src + i)) {
+			/* A gap may be filled by an inherited value. */
+			return -1;
+		}
+		if (!DUK_TVAL_IS_UNDEFINED(tv_src + i)) {
+			n++;
+		}
+	}
 
-	l = lo + 1;
-	r = hi;
-	for (;;) {
-		/* find elements to swap */
-		for (;;) {
-			DUK_DDD(DUK_DDDPRINT("left scan: l=%ld, r=%ld, p=%ld",
-			                     (long) l, (long) r, (long) p));
-			if (l >= hi) {
-				break;
-			}
-			if (duk__array_sort_compare(thr, l, p) >= 0) {  /* !(l < p) */
-				break;
-			}
-			l++;
+	/* The allocation may have side effects (GC compacting or abandoning
+	 * the array part, finalizers), so recheck everything while copying.
+	 */
+	tv_dst = duk_push_harray_with_size_outptr(thr, n);
+	h_arr = duk__arraypart_fastpath_this(thr);
+	if (h_arr == NULL || h_arr->length != len) {
+		goto fail;
+	}
+	tv_src = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+	left = n;
+	for (i = 0; i < len; i++) {
+		if (DUK_TVAL_IS_UNUSED(tv_src)) {
+			goto fail;
 		}
-		for (;;) {
-			DUK_DDD(DUK_DDDPRINT("right scan: l=%ld, r=%ld, p=%ld",
-			                     (long) l, (long) r, (long) p));
-			if (r <= lo) {
-				break;
-			}
-			if (duk__array_sort_compare(thr, p, r) >= 0) {  /* !(p < r) */
-				break;
+		if (!DUK_TVAL_IS_UNDEFINED(tv_src)) {
+			if (left == 0) {
+				goto fail;
 			}
-			r--;
+			left--;
+			DUK_TVAL_SET_TVAL(tv_dst, tv_src);
+			DUK_TVAL_INCREF(thr, tv_dst);
+			tv_dst++;
 		}
-		if (l >= r) {
-			goto done;
-		}
-		DUK_ASSERT(l < r);
+		tv_src++;
+	}
+	if (left != 0) {
+		goto fail;
+	}
+	return (duk_int_t) n;
 
-		DUK_DDD(DUK_DDDPRINT("swap %ld and %ld", (long) l, (long) r));
+ fail:
+	/* Values copied so far are released with the temporary. */
+	duk_pop_unsafe(thr);
+	return -1;
+}
 
-		duk__array_sort_swap(thr, l, r);
+/* Write sorted values back into a dense Array.  Returns 0 if the fast path
+ * doesn't apply.
+ */
+DUK_LOCAL duk_bool_t duk__array_sort_write_fastpath(duk_hthread *thr, duk__array_sort_ctx *ctx, duk_uint32_t len, duk_uint32_t n, duk_uint32_t n_undef) {
+	duk_harray *h_arr;
+	duk_tval *tv_dst;
+	duk_tval *tv_values;
+	duk_tval tv_old;
+	duk_uint32_t i;
 
-		DUK_DDD(DUK_DDDPRINT("after swap: %!T", (duk_tval *) duk_get_tval(thr, 1)));
-		l++;
-		r--;
+	h_arr = duk__arraypart_fastpath_this_writable(thr);
+	if (h_arr == NULL || h_arr->length != len) {
+		return 0;
 	}
- done:
-	/* Note that 'l' and 'r' may cross, i.e. r < l */
-	DUK_ASSERT(l >= lo && l <= hi);
-	DUK_ASSERT(r >= lo && r <= hi);
+	tv_dst = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+	tv_values = DUK_HOBJECT_A_GET_BASE(thr->heap, ctx->h_values);
 
-	/* XXX: there's no explicit recursion bound here now.  For the average
-	 * qsort recursion depth O(log n) that's not really necessary: e.g. for
-	 * 2**32 recursion depth would be about 32 which is OK.  However, qsort
-	 * worst case recursion depth is O(n) which may be a problem.
+	/* Old values are released with NORZ so that no finalizer can run
+	 * while the array part is being updated.
 	 */
-
-	/* move pivot to its final place */
-	DUK_DDD(DUK_DDDPRINT("before final pivot swap: %!T", (duk_tval *) duk_get_tval(thr, 1)));
-	duk__array_sort_swap(thr, lo, r);
-
-#if defined(DUK_USE_DEBUG_LEVEL) && (DUK_USE_DEBUG_LEVEL >= 2)
-	duk__debuglog_qsort_state(thr, lo, hi, r);
-#endif
-
-	DUK_DDD(DUK_DDDPRINT("recurse: pivot=%ld, obj=%!T", (long) r, (duk_tval *) duk_get_tval(thr, 1)));
-	duk__array_qsort(thr, lo, r - 1);
-	duk__array_qsort(thr, r + 1, hi);
+	for (i = 0; i < len; i++) {
+		DUK_TVAL_SET_TVAL(&tv_old, tv_dst);
+		if (i < n) {
+			DUK_TVAL_SET_TVAL(tv_dst, tv_values + ctx->perm[i]);
+			DUK_TVAL_INCREF(thr, tv_dst);
+		} else if (i < n + n_undef) {
+			DUK_TVAL_SET_UNDEFINED(tv_dst);
+		} else {
+			DUK_TVAL_SET_UNUSED(tv_dst);
+		}
+		DUK_TVAL_DECREF_NORZ(thr, &tv_old);
+		tv_dst++;
+	}
+	DUK_REFZERO_CHECK_SLOW(thr);
+	return 1;
 }
+#endif  /* DUK_USE_ARRAY_FASTPATH */
 
 DUK_INTERNAL duk_ret_t duk_bi_array_prototype_sort(duk_hthread *thr) {
+	duk__array_sort_ctx ctx;
 	duk_uint32_t len;
+	duk_uint32_t n;
+	duk_uint32_t n_undef;
+	duk_uint32_t i;
+	duk_size_t sz;
+	duk_tval *tv;
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_int_t rc;
+#endif
 
 	/* XXX: len >= 0x80000000 won't work below because a signed type
-	 * is needed by qsort.
+	 * is needed for the fast path value count.
 	 */
 	len = duk__push_this_obj_len_u32_limited(thr);
 
 	/* stack[0] = compareFn
 	 * stack[1] = ToObject(this)
 	 * stack[2] = ToUint32(length)
+	 * stack[3] = values to be sorted
+	 * stack[4] = sort keys (or undefined)
+	 * stack[5] = permutation and merge scratch buffer
 	 */
 
-	if (len > 0) {
-		/* avoid degenerate cases, so that (len - 1) won't underflow */
-		duk__array_qsort(thr, (duk_int_t) 0, (duk_int_t) (len - 1));
+	DUK_ASSERT_TOP(thr, 3);
+
+	/* Read present, non-undefined values; gaps are left out and
+	 * undefined values are only counted.
+	 */
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	rc = duk__array_sort_read_fastpath(thr, len);
+	if (rc >= 0) {
+		n = (duk_uint32_t) rc;
+		n_undef = len - n;
+	} else
+#endif
+	{
+		duk_push_array(thr);
+		n = 0;
+		n_undef = 0;
+		for (i = 0; i < len; i++) {
+			if (duk_get_prop_index(thr, DUK__SORT_IDX_OBJ, (duk_uarridx_t) i)) {
+				if (duk_is_undefined(thr, -1)) {
+					n_undef++;
+					duk_pop_unsafe(thr);
+				} else {
+					duk_xdef_prop_index_wec(thr, DUK__SORT_IDX_VALUES, (duk_uarridx_t) n);
+					n++;
+				}
+			} else {
+				duk_pop_unsafe(thr);
+			}
+		}
+	}
+	DUK_ASSERT_TOP(thr, DUK__SORT_IDX_VALUES + 1);
+	DUK_ASSERT(n + n_undef <= len);
+
+	ctx.thr = thr;
+	ctx.h_values = duk_known_hobject(thr, DUK__SORT_IDX_VALUES);
+	ctx.h_keys = NULL;
+	DUK_ASSERT(n == 0 || DUK_HOBJECT_GET_ASIZE(ctx.h_values) >= n);
+
+	if (n >= 2 && duk_is_undefined(thr, DUK__SORT_IDX_FN)) {
+		/* Precompute keys for values whose ToString() coercion has
+		 * no side effects.  The key array is fully populated so that
+		 * it keeps its array part.
+		 */
+		duk_push_harray_with_size(thr, n);
+		for (i = 0; i < n; i++) {
+			tv = DUK_HOBJECT_A_GET_BASE(thr->heap, ctx.h_values) + i;
+			if ((DUK_TVAL_IS_STRING(tv) && !DUK_HSTRING_HAS_SYMBOL(DUK_TVAL_GET_STRING(tv))) ||
+			    DUK_TVAL_IS_NUMBER(tv) || DUK_TVAL_IS_BOOLEAN(tv) || DUK_TVAL_IS_NULL(tv)) {
+				duk_push_tval(thr, tv);
+				(void) duk_to_hstring_m1(thr);
+			} else {
+				/* Coerced when compared; e.g. symbols must only
+				 * throw if actually compared.
+				 */
+				duk_push_undefined(thr);
+			}
+			duk_xdef_prop_index_wec(thr, DUK__SORT_IDX_KEYS, (duk_uarridx_t) i);
+		}
+		ctx.h_keys = duk_known_hobject(thr, DUK__SORT_IDX_KEYS);
+		DUK_ASSERT(DUK_HOBJECT_GET_ASIZE(ctx.h_keys) >= n);
+	} else {
+		duk_push_undefined(thr);
+	}
+
+	sz = (duk_size_t) n;
+	if (DUK_UNLIKELY(sz > DUK_SIZE_MAX / (2U * sizeof(duk_uint32_t)))) {
+		DUK_ERROR_RANGE_INVALID_LENGTH(thr);
+		DUK_WO_NORETURN(return 0;);
+	}
+	ctx.perm = (duk_uint32_t *) duk_push_fixed_buffer_nozero(thr, sz * 2U * sizeof(duk_uint32_t));
+	ctx.scratch = ctx.perm + n;
+	for (i = 0; i < n; i++) {
+		ctx.perm[i] = i;
 	}
 
-	DUK_ASSERT_TOP(thr, 3);
-	duk_pop_nodecref_unsafe(thr);
+	duk__array_sort_perm(&ctx, n);
+
+	/* Write back sorted values, then undefined values, then delete
+	 * the rest.
+	 */
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	if (!duk__array_sort_write_fastpath(thr, &ctx, len, n, n_undef))
+#endif
+	{
+		for (i = 0; i < len; i++) {
+			if (i < n) {
+				duk_push_tval(thr, DUK_HOBJECT_A_GET_BASE(thr->heap, ctx.h_values) + ctx.perm[i]);
+				duk_put_prop_index(thr, DUK__SORT_IDX_OBJ, (duk_uarridx_t) i);
+			} else if (i < n + n_undef) {
+				duk_push_undefined(thr);
+				duk_put_prop_index(thr, DUK__SORT_IDX_OBJ, (duk_uarridx_t) i);
+			} else {
+				duk_del_prop_index(thr, DUK__SORT_IDX_OBJ, (duk_uarridx_t) i);
+			}
+		}
+	}
+
+	duk_set_top(thr, DUK__SORT_IDX_OBJ + 1);
 	return 1;  /* return ToObject(this) */
 }
 
@@ -947,6 +1367,65 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_sort(duk_hthread *thr) {
  *   unshift is (close to?) <--> splice(0, 0, [items])?
  */
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+DUK_LOCAL duk_ret_t duk__array_splice_fastpath(duk_hthread *thr, duk_uint32_t len, duk_uint32_t act_start, duk_uint32_t del_count, duk_uint32_t item_count) {
+	duk_harray *h_arr;
+	duk_tval *tv_arraypart;
+	duk_tval *tv_res;
+	duk_tval *tv_src;
+	duk_tval *tv_dst;
+	duk_uint32_t new_len;
+	duk_uint32_t i;
+
+	DUK_ASSERT(act_start + del_count <= len);
+
+	/* Push the result first: the allocation may trigger a GC which may
+	 * compact or abandon the array part of 'this'.  Argument coercion
+	 * may also have had arbitrary side effects, so the fast path
+	 * conditions are only checked here.
+	 */
+	tv_res = duk_push_harray_with_size_outptr(thr, del_count);
+	DUK_ASSERT(del_count == 0 || tv_res != NULL);
+
+	h_arr = duk__arraypart_fastpath_this_writable(thr);
+	new_len = len - del_count + item_count;
+	if (h_arr == NULL || h_arr->length != len ||
+	    new_len > DUK_HOBJECT_GET_ASIZE((duk_hobject *) h_arr)) {
+		DUK_DD(DUK_DDPRINT("array splice() fast path rejected"));
+		duk_pop_unsafe(thr);
+		return 0;
+	}
+	tv_arraypart = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+
+	/* No net refcount changes below: values are moved between the Array,
+	 * the result, and the value stack (which is left with 'undefined'
+	 * values).  Gaps are moved as gaps.
+	 */
+	duk_memcpy_unsafe((void *) tv_res,
+	                  (const void *) (tv_arraypart + act_start),
+	                  (duk_size_t) del_count * sizeof(duk_tval));
+	duk_memmove_unsafe((void *) (tv_arraypart + act_start + item_count),
+	                   (const void *) (tv_arraypart + act_start + del_count),
+	                   (duk_size_t) (len - act_start - del_count) * sizeof(duk_tval));
+	for (i = new_len; i < len; i++) {
+		DUK_TVAL_SET_UNUSED(tv_arraypart + i);
+	}
+
+	tv_src = thr->valstack_bottom + 2;  /* items start at index 2 */
+	tv_dst = tv_arraypart + act_start;
+	for (i = 0; i < item_count; i++) {
+		DUK_TVAL_SET_TVAL(tv_dst, tv_src);
+		DUK_TVAL_SET_UNDEFINED(tv_src);
+		tv_src++;
+		tv_dst++;
+	}
+	h_arr->length = new_len;
+
+	/* Result array is already at the top of stack. */
+	return 1;
+}
+#endif  /* DUK_USE_ARRAY_FASTPATH */
+
 DUK_INTERNAL duk_ret_t duk_bi_array_prototype_splice(duk_hthread *thr) {
 	duk_idx_t nargs;
 	duk_uint32_t len_u32;
@@ -1008,6 +1487,16 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_splice(duk_hthread *thr) {
 		DUK_DCERROR_RANGE_INVALID_LENGTH(thr);
 	}
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	if (duk__array_splice_fastpath(thr,
+	                               (duk_uint32_t) len,
+	                               (duk_uint32_t) act_start,
+	                               (duk_uint32_t) del_count,
+	                               (duk_uint32_t) item_count) != 0) {
+		return 1;
+	}
+#endif
+
 	duk_push_array(thr);
 
 	/* stack[0] = start
@@ -1114,11 +1603,48 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_splice(duk_hthread *thr) {
  *  reverse()
  */
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+DUK_LOCAL void duk__array_reverse_fastpath(duk_hthread *thr, duk_harray *h_arr) {
+	duk_tval *tv_lower;
+	duk_tval *tv_upper;
+	duk_tval tv_tmp;
+
+	DUK_UNREF(thr);
+
+	if (h_arr->length <= 1) {
+		return;
+	}
+
+	/* Swap in place, no refcount changes.  Gaps are swapped as gaps. */
+	tv_lower = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+	tv_upper = tv_lower + h_arr->length - 1;
+	while (tv_lower < tv_upper) {
+		DUK_TVAL_SET_TVAL(&tv_tmp, tv_lower);
+		DUK_TVAL_SET_TVAL(tv_lower, tv_upper);
+		DUK_TVAL_SET_TVAL(tv_upper, &tv_tmp);
+		tv_lower++;
+		tv_upper--;
+	}
+}
+#endif  /* DUK_USE_ARRAY_FASTPATH */
+
 DUK_INTERNAL duk_ret_t duk_bi_array_prototype_reverse(duk_hthread *thr) {
 	duk_uint32_t len;
 	duk_uint32_t middle;
 	duk_uint32_t lower, upper;
 	duk_bool_t have_lower, have_upper;
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_harray *h_arr;
+#endif
+
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	h_arr = duk__arraypart_fastpath_this_writable(thr);
+	if (h_arr) {
+		duk__array_reverse_fastpath(thr, h_arr);
+		duk_push_this(thr);
+		return 1;
+	}
+#endif
 
 	len = duk__push_this_obj_len_u32(thr);
 	middle = len / 2;
@@ -1231,9 +1757,55 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_slice(duk_hthread *thr) {
  *  shift()
  */
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+DUK_LOCAL duk_ret_t duk__array_shift_fastpath(duk_hthread *thr, duk_harray *h_arr) {
+	duk_tval *tv_arraypart;
+	duk_uint32_t len;
+
+	tv_arraypart = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+	len = h_arr->length;
+	if (len <= 0) {
+		/* nop, return undefined */
+		return 0;
+	}
+
+	/* Like pop(), no net refcount change and no check for an index
+	 * property inherited from Array.prototype.
+	 */
+	DUK_ASSERT_VS_SPACE(thr);
+	if (DUK_TVAL_IS_UNUSED(tv_arraypart)) {
+		DUK_ASSERT(DUK_TVAL_IS_UNDEFINED(thr->valstack_top));
+	} else {
+		DUK_TVAL_SET_TVAL(thr->valstack_top, tv_arraypart);
+	}
+	thr->valstack_top++;
+
+	len--;
+	duk_memmove_unsafe((void *) tv_arraypart,
+	                   (const void *) (tv_arraypart + 1),
+	                   (duk_size_t) len * sizeof(duk_tval));
+	DUK_TVAL_SET_UNUSED(tv_arraypart + len);
+	h_arr->length = len;
+
+	return 1;
+}
+#endif  /* DUK_USE_ARRAY_FASTPATH */
+
 DUK_INTERNAL duk_ret_t duk_bi_array_prototype_shift(duk_hthread *thr) {
 	duk_uint32_t len;
 	duk_uint32_t i;
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_harray *h_arr;
+#endif
+
+	DUK_ASSERT_TOP(thr, 0);
+
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	h_arr = duk__arraypart_fastpath_this_writable(thr);
+	if (h_arr) {
+		return duk__array_shift_fastpath(thr, h_arr);
+	}
+#endif
 
 	len = duk__push_this_obj_len_u32(thr);
 	if (len == 0) {
@@ -1273,10 +1845,72 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_shift(duk_hthread *thr) {
  *  unshift()
  */
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+DUK_LOCAL duk_ret_t duk__array_unshift_fastpath(duk_hthread *thr, duk_harray *h_arr) {
+	duk_tval *tv_arraypart;
+	duk_tval *tv_src;
+	duk_tval *tv_dst;
+	duk_uint32_t len;
+	duk_idx_t i, n;
+
+	len = h_arr->length;
+	tv_arraypart = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+
+	n = (duk_idx_t) (thr->valstack_top - thr->valstack_bottom);
+	DUK_ASSERT(n >= 0);
+	DUK_ASSERT((duk_uint32_t) n <= DUK_UINT32_MAX);
+	if (DUK_UNLIKELY(len + (duk_uint32_t) n < len) ||
+	    len + (duk_uint32_t) n > DUK_HOBJECT_GET_ASIZE((duk_hobject *) h_arr)) {
+		/* Length overflow or array part would need to be extended,
+		 * handled by the slow path.
+		 */
+		return 0;
+	}
+
+	duk_memmove_unsafe((void *) (tv_arraypart + n),
+	                   (const void *) tv_arraypart,
+	                   (duk_size_t) len * sizeof(duk_tval));
+
+	/* No net refcount change; reset value stack values to undefined
+	 * to satisfy value stack init policy.
+	 */
+	tv_src = thr->valstack_bottom;
+	tv_dst = tv_arraypart;
+	for (i = 0; i < n; i++) {
+		DUK_TVAL_SET_TVAL(tv_dst, tv_src);
+		DUK_TVAL_SET_UNDEFINED(tv_src);
+		tv_src++;
+		tv_dst++;
+	}
+	thr->valstack_top = thr->valstack_bottom;
+	len += (duk_uint32_t) n;
+	h_arr->length = len;
+
+	DUK_ASSERT((duk_uint_t) len == len);
+	duk_push_uint(thr, (duk_uint_t) len);
+	return 1;
+}
+#endif  /* DUK_USE_ARRAY_FASTPATH */
+
 DUK_INTERNAL duk_ret_t duk_bi_array_prototype_unshift(duk_hthread *thr) {
 	duk_idx_t nargs;
 	duk_uint32_t len;
 	duk_uint32_t i;
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_harray *h_arr;
+#endif
+
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	h_arr = duk__arraypart_fastpath_this_writable(thr);
+	if (h_arr) {
+		duk_ret_t rc;
+		rc = duk__array_unshift_fastpath(thr, h_arr);
+		if (rc != 0) {
+			return rc;
+		}
+		DUK_DD(DUK_DDPRINT("array unshift() fast path exited, resize case"));
+	}
+#endif
 
 	nargs = duk_get_top(thr);
 	len = duk__push_this_obj_len_u32(thr);
@@ -1431,6 +2065,65 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_indexof_shared(duk_hthread *thr) {
 #define DUK__ITER_MAP      3
 #define DUK__ITER_FILTER   4
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+/* Push element 'idx' of the Array at 'idx_obj' and return 1 if it is
+ * present in the array part.  Otherwise push nothing and return 0, and
+ * the caller must use a normal property lookup (which also handles gaps
+ * filled by inherited properties).  The checks are cheap so they are
+ * repeated for every element: a callback may modify the Array in
+ * arbitrary ways, e.g. change its length or abandon the array part.
+ */
+DUK_LOCAL duk_bool_t duk__array_get_index_fastpath(duk_hthread *thr, duk_idx_t idx_obj, duk_uarridx_t idx) {
+	duk_hobject *h;
+	duk_tval *tv;
+
+	h = duk_known_hobject(thr, idx_obj);
+	if (!DUK_HOBJECT_HAS_EXOTIC_ARRAY(h) || !DUK_HOBJECT_HAS_ARRAY_PART(h) ||
+	    idx >= DUK_HOBJECT_GET_ASIZE(h)) {
+		return 0;
+	}
+	tv = DUK_HOBJECT_A_GET_BASE(thr->heap, h) + idx;
+	if (DUK_TVAL_IS_UNUSED(tv)) {
+		return 0;
+	}
+	DUK_ASSERT(idx < ((duk_harray *) h)->length);
+	duk_push_tval(thr, tv);
+	return 1;
+}
+#endif  /* DUK_USE_ARRAY_FASTPATH */
+
+/* Define result[idx] = value at stack top for a fresh result Array at
+ * 'idx_res' and pop the value.
+ */
+DUK_LOCAL void duk__array_put_result(duk_hthread *thr, duk_idx_t idx_res, duk_uarridx_t idx) {
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_harray *h_res;
+	duk_tval *tv_src;
+	duk_tval *tv_dst;
+
+	/* A pre-sized result is usually written directly.  Because it is
+	 * sparse until filled, an emergency GC may abandon its array part,
+	 * so check before every write.
+	 */
+	h_res = (duk_harray *) duk_known_hobject(thr, idx_res);
+	DUK_ASSERT(DUK_HOBJECT_HAS_EXOTIC_ARRAY((duk_hobject *) h_res));
+	if (DUK_HOBJECT_HAS_ARRAY_PART((duk_hobject *) h_res) &&
+	    idx < h_res->length &&
+	    idx < DUK_HOBJECT_GET_ASIZE((duk_hobject *) h_res)) {
+		tv_dst = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_res) + idx;
+		DUK_ASSERT(DUK_TVAL_IS_UNUSED(tv_dst));
+
+		/* No net refcount change. */
+		tv_src = thr->valstack_top - 1;
+		DUK_TVAL_SET_TVAL(tv_dst, tv_src);
+		DUK_TVAL_SET_UNDEFINED(tv_src);
+		thr->valstack_top--;
+		return;
+	}
+#endif
+	duk_xdef_prop_index_wec(thr, idx_res, idx);
+}
+
 /* XXX: This helper is a bit awkward because the handling for the different iteration
  * callers is quite different.  This now compiles to a bit less than 500 bytes, so with
  * 5 callers the net result is about 100 bytes / caller.
@@ -1452,7 +2145,18 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_iter_shared(duk_hthread *thr) {
 	/* if thisArg not supplied, behave as if undefined was supplied */
 
 	if (iter_type == DUK__ITER_MAP || iter_type == DUK__ITER_FILTER) {
-		duk_push_array(thr);
+#if defined(DUK_USE_ARRAY_FASTPATH)
+		/* For a dense Array the result array part can be allocated
+		 * up front: its size is bounded by 'len' for both map() and
+		 * filter(), and 'len' is bounded by the source allocation.
+		 */
+		if (duk__arraypart_fastpath_this(thr) != NULL) {
+			duk_push_harray_with_size(thr, len);
+		} else
+#endif
+		{
+			duk_push_array(thr);
+		}
 	} else {
 		duk_push_undefined(thr);
 	}
@@ -1468,6 +2172,11 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_iter_shared(duk_hthread *thr) {
 	for (i = 0; i < len; i++) {
 		DUK_ASSERT_TOP(thr, 5);
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+		if (duk__array_get_index_fastpath(thr, 2, (duk_uarridx_t) i)) {
+			;
+		} else
+#endif
 		if (!duk_get_prop_index(thr, 2, (duk_uarridx_t) i)) {
 			/* For 'map' trailing missing elements don't invoke the
 			 * callback but count towards the result length.
@@ -1511,14 +2220,14 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_iter_shared(duk_hthread *thr) {
 			break;
 		case DUK__ITER_MAP:
 			duk_dup_top(thr);
-			duk_xdef_prop_index_wec(thr, 4, (duk_uarridx_t) i);  /* retval to result[i] */
+			duk__array_put_result(thr, 4, (duk_uarridx_t) i);  /* retval to result[i] */
 			res_length = i + 1;
 			break;
 		case DUK__ITER_FILTER:
 			bval = duk_to_boolean(thr, -1);
 			if (bval) {
 				duk_dup_m2(thr);  /* orig value */
-				duk_xdef_prop_index_wec(thr, 4, (duk_uarridx_t) k);
+				duk__array_put_result(thr, 4, (duk_uarridx_t) k);
 				k++;
 				res_length = k;
 			}
@@ -1548,6 +2257,12 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_iter_shared(duk_hthread *thr) {
 		DUK_ASSERT(duk_is_array(thr, -1));  /* topmost element is the result array already */
 		duk_push_u32(thr, res_length);
 		duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_LENGTH, DUK_PROPDESC_FLAGS_W);
+#if defined(DUK_USE_ARRAY_FASTPATH)
+		if (res_length < len && iter_type == DUK__ITER_FILTER) {
+			/* Release the unused part of a pre-sized result. */
+			duk_hobject_compact_props(thr, duk_known_hobject(thr, -1));
+		}
+#endif
 		break;
 	default:
 		DUK_UNREACHABLE();
@@ -1609,20 +2324,27 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_reduce_shared(duk_hthread *thr) {
 		DUK_ASSERT((have_acc && duk_get_top(thr) == 5) ||
 		           (!have_acc && duk_get_top(thr) == 4));
 
-		if (!duk_has_prop_index(thr, 2, (duk_uarridx_t) i)) {
+#if defined(DUK_USE_ARRAY_FASTPATH)
+		if (duk__array_get_index_fastpath(thr, 2, (duk_uarridx_t) i)) {
+			;
+		} else
+#endif
+		if (duk_has_prop_index(thr, 2, (duk_uarridx_t) i)) {
+			duk_get_prop_index(thr, 2, (duk_uarridx_t) i);
+		} else {
 			continue;
 		}
 
+		/* [ ... acc? value ] */
+
 		if (!have_acc) {
-			DUK_ASSERT_TOP(thr, 4);
-			duk_get_prop_index(thr, 2, (duk_uarridx_t) i);
-			have_acc = 1;
 			DUK_ASSERT_TOP(thr, 5);
+			have_acc = 1;
 		} else {
-			DUK_ASSERT_TOP(thr, 5);
+			DUK_ASSERT_TOP(thr, 6);
 			duk_dup_0(thr);
 			duk_dup(thr, 4);
-			duk_get_prop_index(thr, 2, (duk_uarridx_t) i);
+			duk_dup(thr, 5);
 			duk_push_u32(thr, i);
 			duk_dup_2(thr);
 			DUK_DDD(DUK_DDDPRINT("calling reduce function: func=%!T, prev=%!T, curr=%!T, idx=%!T, obj=%!T",
@@ -1632,6 +2354,7 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_reduce_shared(duk_hthread *thr) {
 			duk_call(thr, 4);
 			DUK_DDD(DUK_DDDPRINT("-> result: %!T", (duk_tval *) duk_get_tval(thr, -1)));
 			duk_replace(thr, 4);
+			duk_pop_unsafe(thr);
 			DUK_ASSERT_TOP(thr, 5);
 		}
 	}
@@ -23,7 +23,6 @@
  */
 
 #define DUK__JSON_DECSTR_BUFSIZE 128
-#define DUK__JSON_DECSTR_CHUNKSIZE 64
 #define DUK__JSON_ENCSTR_CHUNKSIZE 64
 #define DUK__JSON_STRINGIFY_BUFSIZE 128
 #define DUK__JSON_MAX_ESC_LEN 10  /* '\Udeadbeef' */
@@ -384,11 +383,66 @@ DUK_LOCAL duk_small_int_t duk__dec_string_escape(duk_json_dec_ctx *js_ctx, duk_u
 	return 0;
 }
 
+#if defined(DUK_USE_JSON_DECSTRING_FASTPATH)
+/* Scan forward from 'p' over a run of string bytes which decode as is,
+ * i.e. stop at the first '"', '\\', or control character.  End of input
+ * (NUL) also stops the scan so no bounds check is needed in the byte loop.
+ * Aligned 4-byte words are checked for all three byte classes at once.
+ */
+DUK_LOCAL const duk_uint8_t *duk__dec_string_scan(duk_json_dec_ctx *js_ctx, const duk_uint8_t *p) {
+	const duk_uint8_t *p_end;
+
+	p_end = js_ctx->p_end;
+	DUK_ASSERT(p <= p_end);
+	DUK_ASSERT(*p_end == 0x00);
+
+	while (((duk_size_t) (const void *) p) & 0x03U) {
+		if (duk__json_decstr_lookup[*p] == 0) {
+			return p;
+		}
+		p++;
+	}
+
+	while ((duk_size_t) (p_end - p) >= 4U) {
+		duk_uint32_t x, y, z, t;
+
+		x = *((const duk_uint32_t *) (const void *) p);
+		y = x ^ 0x22222222UL;  /* '"' bytes become zero */
+		z = x ^ 0x5c5c5c5cUL;  /* '\\' bytes become zero */
+
+		/* High bit of some byte is set iff any byte of 'x' is < 0x20
+		 * or any byte of 'y' or 'z' is zero.
+		 */
+		t = ((x - 0x20202020UL) & ~x) |
+		    ((y - 0x01010101UL) & ~y) |
+		    ((z - 0x01010101UL) & ~z);
+		if (DUK_UNLIKELY((t & 0x80808080UL) != 0)) {
+			break;
+		}
+		p += 4;
+	}
+
+	/* Locate the exact byte; guaranteed to terminate at NUL. */
+	DUK_ASSERT(duk__json_decstr_lookup[0] == 0x00);
+	while (duk__json_decstr_lookup[*p] != 0) {
+		p++;
+	}
+	DUK_ASSERT(p <= p_end);
+	return p;
+}
+#endif  /* DUK_USE_JSON_DECSTRING_FASTPATH */
+
 DUK_LOCAL void duk__dec_string(duk_json_dec_ctx *js_ctx) {
 	duk_hthread *thr = js_ctx->thr;
 	duk_bufwriter_ctx bw_alloc;
 	duk_bufwriter_ctx *bw;
 	duk_uint8_t *q;
+#if defined(DUK_USE_JSON_DECSTRING_FASTPATH)
+	const duk_uint8_t *p;
+	const duk_uint8_t *p_run;
+	duk_size_t run_len;
+	duk_uint8_t b;
+#endif
 
 	/* '"' was eaten by caller */
 
@@ -397,63 +451,51 @@ DUK_LOCAL void duk__dec_string(duk_json_dec_ctx *js_ctx) {
 	 * so they'll simply pass through (valid UTF-8 or not).
 	 */
 
+#if defined(DUK_USE_JSON_DECSTRING_FASTPATH)
+	/* Strings without escapes are very common: intern them directly
+	 * from the input without going through a temporary buffer.
+	 */
+	p = js_ctx->p;
+	p_run = duk__dec_string_scan(js_ctx, p);
+	if (DUK_LIKELY(*p_run == DUK_ASC_DOUBLEQUOTE)) {
+		duk_push_lstring(thr, (const char *) p, (duk_size_t) (p_run - p));
+		js_ctx->p = p_run + 1;
+		return;
+	}
+#endif
+
 	bw = &bw_alloc;
 	DUK_BW_INIT_PUSHBUF(js_ctx->thr, bw, DUK__JSON_DECSTR_BUFSIZE);
 	q = DUK_BW_GET_PTR(js_ctx->thr, bw);
 
 #if defined(DUK_USE_JSON_DECSTRING_FASTPATH)
 	for (;;) {
-		duk_small_uint_t safe;
-		duk_uint8_t b, x;
-		const duk_uint8_t *p;
-
-		/* Select a safe loop count where no output checks are
-		 * needed assuming we won't encounter escapes.  Input
-		 * bound checks are not necessary as a NUL (guaranteed)
-		 * will cause a SyntaxError before we read out of bounds.
+		/* Copy a run of plain bytes, then deal with the byte which
+		 * ended the run.  'p_run' is valid on entry.
 		 */
+		run_len = (duk_size_t) (p_run - p);
 
-		safe = DUK__JSON_DECSTR_CHUNKSIZE;
-
-		/* Ensure space for 1:1 output plus one escape. */
-		q = DUK_BW_ENSURE_RAW(js_ctx->thr, bw, safe + DUK_UNICODE_MAX_XUTF8_LENGTH, q);
-
-		p = js_ctx->p;  /* temp copy, write back for next loop */
-		for (;;) {
-			if (safe == 0) {
-				js_ctx->p = p;
-				break;
-			}
-			safe--;
-
-			/* End of input (NUL) goes through slow path and causes SyntaxError. */
-			DUK_ASSERT(duk__json_decstr_lookup[0] == 0x00);
+		/* Ensure space for the run plus one escape. */
+		q = DUK_BW_ENSURE_RAW(js_ctx->thr, bw, run_len + DUK_UNICODE_MAX_XUTF8_LENGTH, q);
+		duk_memcpy((void *) q, (const void *) p, run_len);
+		q += run_len;
 
-			b = *p++;
-			x = (duk_small_int_t) duk__json_decstr_lookup[b];
-			if (DUK_LIKELY(x != 0)) {
-				/* Fast path, decode as is. */
-				*q++ = b;
-			} else if (b == DUK_ASC_DOUBLEQUOTE) {
-				js_ctx->p = p;
-				goto found_quote;
-			} else if (b == DUK_ASC_BACKSLASH) {
-				/* We've ensured space for one escaped input; then
-				 * bail out and recheck (this makes escape handling
-				 * quite slow but it's uncommon).
-				 */
-				js_ctx->p = p;
-				if (duk__dec_string_escape(js_ctx, &q) != 0) {
-					goto syntax_error;
-				}
-				break;
-			} else {
-				js_ctx->p = p;
+		b = *p_run;
+		js_ctx->p = p_run + 1;
+		if (b == DUK_ASC_DOUBLEQUOTE) {
+			break;
+		} else if (b == DUK_ASC_BACKSLASH) {
+			if (duk__dec_string_escape(js_ctx, &q) != 0) {
 				goto syntax_error;
 			}
+		} else {
+			/* Control character or end of input (NUL). */
+			goto syntax_error;
 		}
+
+		p = js_ctx->p;
+		p_run = duk__dec_string_scan(js_ctx, p);
 	}
- found_quote:
 #else  /* DUK_USE_JSON_DECSTRING_FASTPATH */
 	for (;;) {
 		duk_uint8_t x;
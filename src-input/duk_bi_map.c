@@ -0,0 +1,983 @@
+/*
+ *  Map, Set, WeakMap, and WeakSet built-ins
+ *
+ *  Map and Set instances are duk_hmap objects, see duk_hmap.h for the hash
+ *  table layout.  Keys are compared with SameValueZero directly on duk_tvals
+ *  so there's no string coercion or interning involved.
+ *
+ *  Iterator objects are ordinary objects with internal properties:
+ *
+ *    _Target  Map or Set being iterated, undefined once exhausted.
+ *    _Next    Position of the next entry to examine.
+ *    _Gen     Generation record the position is relative to.
+ *    _Kind    DUK__KIND_KEYS, DUK__KIND_VALUES, or DUK__KIND_ENTRIES.
+ *
+ *  WeakMap and WeakSet instances are ordinary objects whose _Value is a
+ *  unique hidden Symbol.  An entry is stored on the key object itself as a
+ *  non-writable, non-configurable own property with the Symbol as its key,
+ *  so that the value stays alive exactly as long as the key.  Limitation:
+ *  entries remain on key objects after the WeakMap itself is collected.
+ */
+
+#include "duk_internal.h"
+
+#if defined(DUK_USE_MAP_BUILTIN)
+
+#define DUK__KIND_KEYS                  0
+#define DUK__KIND_VALUES                1
+#define DUK__KIND_ENTRIES               2
+
+/* Iterator creation magic: bit 0 is set for Set, bits 1-2 are the kind. */
+#define DUK__ITER_MAGIC_SET             1
+#define DUK__ITER_MAGIC_KIND_SHIFT      1
+
+/* WeakMap/WeakSet Symbol prefix, followed by a unique counter value. */
+#define DUK__WEAK_PREFIX_LEN            9
+
+DUK_LOCAL const char * const duk__weak_prefix[2] = {
+	"\x82" "WeakMap" "\xff",
+	"\x82" "WeakSet" "\xff"
+};
+
+/*
+ *  Hash table primitives
+ */
+
+/* MurmurHash3 fmix32 finalizer, spreads pointer and double bits over the
+ * index mask.
+ */
+DUK_LOCAL duk_uint32_t duk__hmap_mix(duk_uint32_t h) {
+	h ^= h >> 16;
+	h *= 0x85ebca6bUL;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35UL;
+	h ^= h >> 16;
+	return h;
+}
+
+/* Hash consistent with duk__hmap_key_equals(): +0 and -0 hash the same,
+ * as do all NaNs, and a fastint hashes the same as the equivalent double.
+ */
+DUK_LOCAL duk_uint32_t duk__hmap_hash(duk_tval *tv) {
+	duk_uint32_t h;
+
+	if (DUK_TVAL_IS_NUMBER(tv)) {
+		duk_double_union du;
+
+		du.d = DUK_TVAL_GET_NUMBER(tv);
+		if (DUK_ISNAN(du.d)) {
+			h = 0x7ff80000UL;
+		} else if (duk_double_equals(du.d, 0.0)) {
+			h = 0;
+		} else {
+			h = du.ui[DUK_DBL_IDX_UI0] ^ du.ui[DUK_DBL_IDX_UI1];
+		}
+	} else if (DUK_TVAL_IS_HEAP_ALLOCATED(tv)) {
+		/* Strings are interned so pointer identity is enough. */
+		h = (duk_uint32_t) (duk_uintptr_t) DUK_TVAL_GET_HEAPHDR(tv);
+	} else if (DUK_TVAL_IS_BOOLEAN(tv)) {
+		h = (duk_uint32_t) DUK_TVAL_GET_TAG(tv) * 2U + (duk_uint32_t) DUK_TVAL_GET_BOOLEAN(tv);
+	} else if (DUK_TVAL_IS_POINTER(tv)) {
+		h = (duk_uint32_t) (duk_uintptr_t) DUK_TVAL_GET_POINTER(tv);
+	} else if (DUK_TVAL_IS_LIGHTFUNC(tv)) {
+		h = (duk_uint32_t) DUK_TVAL_GET_LIGHTFUNC_FLAGS(tv);
+	} else {
+		h = (duk_uint32_t) DUK_TVAL_GET_TAG(tv);
+	}
+	return duk__hmap_mix(h);
+}
+
+/* SameValueZero. */
+DUK_LOCAL duk_bool_t duk__hmap_key_equals(duk_tval *tv_x, duk_tval *tv_y) {
+	if (DUK_TVAL_IS_NUMBER(tv_x)) {
+		duk_double_t d1, d2;
+
+		if (!DUK_TVAL_IS_NUMBER(tv_y)) {
+			return 0;
+		}
+		d1 = DUK_TVAL_GET_NUMBER(tv_x);
+		d2 = DUK_TVAL_GET_NUMBER(tv_y);
+		return duk_double_equals(d1, d2) || (DUK_ISNAN(d1) && DUK_ISNAN(d2));
+	}
+	if (DUK_TVAL_GET_TAG(tv_x) != DUK_TVAL_GET_TAG(tv_y)) {
+		return 0;
+	}
+	if (DUK_TVAL_IS_HEAP_ALLOCATED(tv_x)) {
+		return DUK_TVAL_GET_HEAPHDR(tv_x) == DUK_TVAL_GET_HEAPHDR(tv_y);
+	}
+	return duk_js_samevalue(tv_x, tv_y);
+}
+
+/* Find the entry position of a key, or -1 if not present. */
+DUK_LOCAL duk_int_t duk__hmap_find(duk_hmap *m, duk_tval *tv_key, duk_uint32_t hash) {
+	duk_uint32_t *index;
+	duk_uint32_t mask;
+	duk_uint32_t i;
+	duk_uint32_t stride;
+
+	if (m->e_size == 0) {
+		return -1;
+	}
+	index = DUK_HMAP_GET_INDEX(m);
+	mask = DUK_HMAP_GET_INDEX_MASK(m);
+	stride = DUK_HMAP_GET_STRIDE(m);
+
+	/* The index is at most half full so the probe always terminates.
+	 * Slots of deleted entries have an UNUSED key which never matches.
+	 */
+	for (i = hash & mask; index[i] != 0; i = (i + 1U) & mask) {
+		duk_tval *tv = m->entries + (index[i] - 1U) * stride;
+		if (!DUK_TVAL_IS_UNUSED(tv) && duk__hmap_key_equals(tv_key, tv)) {
+			return (duk_int_t) (index[i] - 1U);
+		}
+	}
+	return -1;
+}
+
+DUK_LOCAL void duk__hmap_index_insert(duk_uint32_t *index, duk_uint32_t mask, duk_uint32_t hash, duk_uint32_t e_idx) {
+	duk_uint32_t i;
+
+	for (i = hash & mask; index[i] != 0; i = (i + 1U) & mask) {
+		;
+	}
+	index[i] = e_idx + 1U;
+}
+
+/* Release a generation record nobody else refers to, i.e. no iterator
+ * has observed the current entry array.
+ */
+DUK_LOCAL duk_bool_t duk__hmap_gen_observed(duk_hmap *m) {
+	if (m->gen == NULL) {
+		return 0;
+	}
+#if defined(DUK_USE_REFERENCE_COUNTING)
+	return DUK_HEAPHDR_GET_REFCOUNT((duk_heaphdr *) m->gen) > 1;
+#else
+	return 1;
+#endif
+}
+
+/* Reallocate the entry array, dropping deleted entries.  When positions of
+ * entries change and some iterator has observed the current generation, a
+ * new generation record listing the dropped positions is chained after the
+ * current one.  May have side effects; the caller must re-check the map
+ * state afterwards.
+ */
+DUK_LOCAL void duk__hmap_resize(duk_hthread *thr, duk_hmap *m) {
+	duk_uint32_t new_size;
+	duk_uint32_t removed;
+	duk_uint32_t stride;
+	duk_uint32_t mask;
+	duk_uint32_t i, j;
+	duk_tval *rec_items = NULL;
+	duk_harray *rec = NULL;
+	duk_harray *old_gen;
+	duk_tval *old_entries;
+	duk_tval *new_entries;
+	duk_uint32_t *new_index;
+	duk_size_t alloc_size;
+
+	DUK_HMAP_ASSERT_VALID(m);
+
+	if (m->count >= DUK_HMAP_MAX_ENTRIES) {
+		DUK_ERROR_RANGE(thr, DUK_STR_INVALID_COUNT);
+		DUK_WO_NORETURN(return;);
+	}
+	new_size = DUK_HMAP_MIN_ENTRIES;
+	while (new_size < m->count * 2U) {
+		new_size *= 2U;
+	}
+	if (new_size > DUK_HMAP_MAX_ENTRIES) {
+		new_size = DUK_HMAP_MAX_ENTRIES;
+	}
+	DUK_ASSERT(new_size > m->count);
+
+	stride = DUK_HMAP_GET_STRIDE(m);
+	removed = m->e_next - m->count;
+
+	if (m->gen != NULL && removed > 0) {
+		if (duk__hmap_gen_observed(m)) {
+			duk_uint32_t e_next = m->e_next;
+			duk_uint32_t count = m->count;
+			duk_harray *gen = m->gen;
+			duk_tval *tv;
+
+			/* Keep the record dense so that GC compaction never
+			 * abandons its array part.
+			 */
+			tv = duk_push_harray_with_size_outptr(thr, removed + 1U);
+			for (i = 0; i <= removed; i++) {
+				DUK_TVAL_SET_UNDEFINED(tv + i);
+			}
+			rec = (duk_harray *) duk_known_hobject(thr, -1);
+			if (m->e_next != e_next || m->count != count || m->gen != gen) {
+				/* Side effects changed the map, let caller retry. */
+				duk_pop_unsafe(thr);
+				return;
+			}
+		} else {
+			old_gen = m->gen;
+			m->gen = NULL;
+			DUK_HOBJECT_DECREF_NORZ(thr, (duk_hobject *) old_gen);
+		}
+	}
+
+	/* Finalizers must not run while the entries are being moved. */
+	alloc_size = DUK_HMAP_COMPUTE_ALLOC_SIZE(new_size, stride);
+	thr->heap->pf_prevent_count++;
+	new_entries = (duk_tval *) DUK_ALLOC(thr->heap, alloc_size);
+	thr->heap->pf_prevent_count--;
+	if (DUK_UNLIKELY(new_entries == NULL)) {
+		DUK_ERROR_ALLOC_FAILED(thr);
+		DUK_WO_NORETURN(return;);
+	}
+	new_index = (duk_uint32_t *) (void *) (new_entries + new_size * stride);
+	duk_memzero((void *) new_index, sizeof(duk_uint32_t) * 2U * new_size);
+	mask = new_size * 2U - 1U;
+
+	if (rec != NULL) {
+		/* Look up only after the allocation, emergency GC may compact
+		 * the record's property table.
+		 */
+		rec_items = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) rec);
+	}
+
+	/* Move live entries as is, refcounts don't change. */
+	old_entries = m->entries;
+	for (i = 0, j = 0; i < m->e_next; i++) {
+		duk_tval *tv_src = old_entries + i * stride;
+		duk_tval *tv_dst;
+
+		if (DUK_TVAL_IS_UNUSED(tv_src)) {
+			if (rec_items != NULL) {
+				DUK_TVAL_SET_U32(rec_items + 1 + (i - j), i);
+			}
+			continue;
+		}
+		tv_dst = new_entries + j * stride;
+		DUK_TVAL_SET_TVAL(tv_dst, tv_src);
+		if (stride > 1U) {
+			DUK_TVAL_SET_TVAL(tv_dst + 1, tv_src + 1);
+		}
+		duk__hmap_index_insert(new_index, mask, duk__hmap_hash(tv_dst), j);
+		j++;
+	}
+	DUK_ASSERT(j == m->count);
+
+	m->entries = new_entries;
+	m->e_size = new_size;
+	m->e_next = j;
+	DUK_FREE(thr->heap, (void *) old_entries);
+
+	if (rec != NULL) {
+		duk_tval *tv_link;
+
+		/* Link the record after the current generation and make it
+		 * current; iterators holding older records follow the chain.
+		 */
+		old_gen = m->gen;
+		DUK_ASSERT(old_gen != NULL);
+		tv_link = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) old_gen);
+		DUK_ASSERT(DUK_TVAL_IS_UNDEFINED(tv_link));
+		DUK_ASSERT(rec_items != NULL);
+		DUK_TVAL_SET_OBJECT(tv_link, (duk_hobject *) rec);
+		DUK_HOBJECT_INCREF(thr, (duk_hobject *) rec);
+		m->gen = rec;
+		DUK_HOBJECT_INCREF(thr, (duk_hobject *) rec);
+		DUK_HOBJECT_DECREF_NORZ(thr, (duk_hobject *) old_gen);
+		duk_pop_unsafe(thr);
+	}
+	DUK_HMAP_ASSERT_VALID(m);
+}
+
+/* Get the current generation record, creating one if necessary, so that
+ * later compactions are recorded for the caller.
+ */
+DUK_LOCAL duk_harray *duk__hmap_observe(duk_hthread *thr, duk_hmap *m) {
+	if (m->gen == NULL) {
+		duk_tval *tv;
+
+		tv = duk_push_harray_with_size_outptr(thr, 1);
+		DUK_TVAL_SET_UNDEFINED(tv);  /* link to the next record */
+		if (m->gen == NULL) {
+			m->gen = (duk_harray *) duk_known_hobject(thr, -1);
+			DUK_HOBJECT_INCREF(thr, (duk_hobject *) m->gen);
+		}
+		duk_pop_unsafe(thr);
+	}
+	return m->gen;
+}
+
+/* Translate an entry position observed in generation 'gen' into a position
+ * in the current entry array.
+ */
+DUK_LOCAL duk_uint32_t duk__hmap_sync_pos(duk_hthread *thr, duk_hmap *m, duk_harray *gen, duk_uint32_t pos) {
+	DUK_UNREF(thr);
+
+	while (gen != m->gen) {
+		duk_tval *tv;
+		duk_uint32_t i, n;
+		duk_uint32_t adj = 0;
+
+		DUK_ASSERT(gen != NULL);
+		tv = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) gen);
+		DUK_ASSERT(DUK_TVAL_IS_OBJECT(tv));
+		gen = (duk_harray *) DUK_TVAL_GET_OBJECT(tv);
+		DUK_ASSERT(gen != NULL);
+
+		/* Dropped positions are in ascending order. */
+		tv = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) gen);
+		n = gen->length;
+		for (i = 1; i < n; i++) {
+			DUK_ASSERT(DUK_TVAL_IS_NUMBER(tv + i));
+			if ((duk_uint32_t) DUK_TVAL_GET_NUMBER(tv + i) >= pos) {
+				break;
+			}
+			adj++;
+		}
+		pos -= adj;
+	}
+	return pos;
+}
+
+/* Insert or update an entry; for a Set 'idx_val' is ignored.  The key and
+ * value are not popped.
+ */
+DUK_LOCAL void duk__hmap_put(duk_hthread *thr, duk_hmap *m, duk_idx_t idx_key, duk_idx_t idx_val) {
+	duk_tval tv_key;
+	duk_tval *tv;
+	duk_uint32_t hash;
+	duk_uint32_t stride;
+	duk_int_t e_idx;
+
+	stride = DUK_HMAP_GET_STRIDE(m);
+	for (;;) {
+		/* Re-read the key after each resize, side effects may have
+		 * reallocated the value stack.
+		 */
+		DUK_TVAL_SET_TVAL(&tv_key, duk_require_tval(thr, idx_key));
+		if (DUK_TVAL_IS_NUMBER(&tv_key) && duk_double_equals(DUK_TVAL_GET_NUMBER(&tv_key), 0.0)) {
+			DUK_TVAL_SET_NUMBER(&tv_key, 0.0);  /* -0 is stored as +0 */
+		}
+		hash = duk__hmap_hash(&tv_key);
+		e_idx = duk__hmap_find(m, &tv_key, hash);
+		if (e_idx >= 0) {
+			if (stride > 1U) {
+				tv = m->entries + (duk_uint32_t) e_idx * stride + 1;
+				DUK_TVAL_SET_TVAL_UPDREF(thr, tv, duk_require_tval(thr, idx_val));  /* side effects */
+			}
+			return;
+		}
+		if (m->e_next < m->e_size) {
+			break;
+		}
+		duk__hmap_resize(thr, m);
+	}
+
+	tv = m->entries + m->e_next * stride;
+	DUK_TVAL_SET_TVAL(tv, &tv_key);
+	DUK_TVAL_INCREF(thr, tv);
+	if (stride > 1U) {
+		DUK_TVAL_SET_TVAL(tv + 1, duk_require_tval(thr, idx_val));
+		DUK_TVAL_INCREF(thr, tv + 1);
+	}
+	duk__hmap_index_insert(DUK_HMAP_GET_INDEX(m), DUK_HMAP_GET_INDEX_MASK(m), hash, m->e_next);
+	m->e_next++;
+	m->count++;
+	DUK_HMAP_ASSERT_VALID(m);
+}
+
+DUK_LOCAL duk_hmap *duk__push_this_hmap(duk_hthread *thr, duk_small_uint_t is_set) {
+	duk_hmap *m;
+
+	duk_push_this(thr);
+	m = (duk_hmap *) duk_require_hobject_with_class(thr, -1, is_set ? DUK_HOBJECT_CLASS_SET : DUK_HOBJECT_CLASS_MAP);
+	DUK_HMAP_ASSERT_VALID(m);
+	return m;
+}
+
+/* [ ... value ] -> [ ... result ] */
+DUK_LOCAL void duk__push_iter_result(duk_hthread *thr, duk_bool_t done) {
+	duk_push_object(thr);
+	duk_insert(thr, -2);
+	duk_put_prop_stridx_short(thr, -2, DUK_STRIDX_VALUE);
+	duk_push_boolean(thr, done);
+	duk_put_prop_literal(thr, -2, "done");
+}
+
+/*
+ *  Constructors
+ */
+
+DUK_LOCAL duk_bool_t duk__map_is_native(duk_hthread *thr, duk_idx_t idx, duk_c_function func) {
+	duk_tval *tv;
+
+	tv = duk_get_tval(thr, idx);
+	if (tv != NULL && DUK_TVAL_IS_LIGHTFUNC(tv)) {
+		return DUK_TVAL_GET_LIGHTFUNC_FUNCPTR(tv) == func;
+	}
+	return duk_get_c_function(thr, idx) == func;
+}
+
+DUK_LOCAL void duk__weakmap_put(duk_hthread *thr, duk_hstring *h_sym, duk_idx_t idx_key, duk_idx_t idx_val);
+
+/* Add entries from an iterable: [ iterable new_obj ] -> [ iterable new_obj ].
+ * The adder method (set() or add()) is looked up as required by the
+ * specification but is bypassed when it's the built-in one.
+ */
+DUK_LOCAL void duk__map_fill(duk_hthread *thr, duk_small_uint_t is_set, duk_bool_t is_weak) {
+	duk_bool_t use_iterator;
+	duk_bool_t fast;
+	duk_uarridx_t index;
+	duk_uarridx_t len = 0;
+	duk_hstring *h_sym = NULL;
+
+	/* 2: adder */
+	if (is_set) {
+		(void) duk_get_prop_literal(thr, 1, "add");
+	} else {
+		(void) duk_get_prop_stridx_short(thr, 1, DUK_STRIDX_SET);
+	}
+	duk_require_callable(thr, 2);
+	if (is_weak) {
+		fast = duk__map_is_native(thr, 2, duk_bi_weakmap_prototype_set);
+		(void) duk_xget_owndataprop_stridx_short(thr, 1, DUK_STRIDX_INT_VALUE);
+		h_sym = duk_known_hstring(thr, -1);
+		duk_pop_unsafe(thr);  /* still reachable through new_obj */
+	} else {
+		fast = duk__map_is_native(thr, 2, duk_bi_map_prototype_set);
+	}
+
+	/* 3: iterator, 4: next method; undefined for array-likes */
+	use_iterator = duk_get_method_stridx(thr, 0, DUK_STRIDX_WELLKNOWN_SYMBOL_ITERATOR);
+	if (use_iterator) {
+		duk_dup_0(thr);
+		duk_call_method(thr, 0);
+		if (!duk_is_object(thr, 3)) {
+			DUK_ERROR_TYPE(thr, DUK_STR_NOT_OBJECT);
+			DUK_WO_NORETURN(return;);
+		}
+		(void) duk_get_prop_literal(thr, 3, "next");
+	} else {
+		duk_push_undefined(thr);
+		duk_push_undefined(thr);
+		len = (duk_uarridx_t) duk_get_length(thr, 0);
+	}
+
+	for (index = 0; ; index++) {
+		/* 5: item */
+		if (use_iterator) {
+			duk_dup(thr, 4);
+			duk_dup(thr, 3);
+			duk_call_method(thr, 0);
+			if (!duk_is_object(thr, 5)) {
+				DUK_ERROR_TYPE(thr, DUK_STR_NOT_OBJECT);
+				DUK_WO_NORETURN(return;);
+			}
+			(void) duk_get_prop_literal(thr, 5, "done");
+			if (duk_to_boolean(thr, -1)) {
+				duk_pop_2_unsafe(thr);
+				break;
+			}
+			duk_pop_unsafe(thr);
+			(void) duk_get_prop_stridx_short(thr, 5, DUK_STRIDX_VALUE);
+			duk_remove(thr, 5);
+		} else {
+			if (index >= len) {
+				break;
+			}
+			(void) duk_get_prop_index(thr, 0, index);
+		}
+
+		/* 6: key, 7: value */
+		if (is_set) {
+			duk_dup(thr, 5);
+			duk_push_true(thr);
+		} else {
+			if (!duk_is_object(thr, 5)) {
+				DUK_ERROR_TYPE(thr, DUK_STR_NOT_OBJECT);
+				DUK_WO_NORETURN(return;);
+			}
+			(void) duk_get_prop_index(thr, 5, 0);
+			(void) duk_get_prop_index(thr, 5, 1);
+		}
+
+		if (fast) {
+			if (is_weak) {
+				duk__weakmap_put(thr, h_sym, 6, 7);
+			} else {
+				duk__hmap_put(thr, (duk_hmap *) duk_known_hobject(thr, 1), 6, 7);
+			}
+		} else {
+			duk_dup(thr, 2);
+			duk_dup_1(thr);
+			duk_dup(thr, 6);
+			if (!is_set) {
+				duk_dup(thr, 7);
+			}
+			duk_call_method(thr, is_set ? 1 : 2);
+			duk_pop_unsafe(thr);
+		}
+		duk_pop_n_unsafe(thr, 3);
+	}
+	duk_set_top(thr, 2);
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_constructor(duk_hthread *thr) {
+	duk_small_uint_t is_set;
+
+	duk_require_constructor_call(thr);
+	is_set = (duk_small_uint_t) duk_get_current_magic(thr);
+
+	(void) duk_push_hmap_raw(thr,
+	                         DUK_HOBJECT_FLAG_EXTENSIBLE |
+	                         DUK_HOBJECT_CLASS_AS_FLAGS(is_set ? DUK_HOBJECT_CLASS_SET : DUK_HOBJECT_CLASS_MAP),
+	                         is_set ? DUK_BIDX_SET_PROTOTYPE : DUK_BIDX_MAP_PROTOTYPE);
+	if (!duk_is_null_or_undefined(thr, 0)) {
+		duk__map_fill(thr, is_set, 0 /*is_weak*/);
+	}
+	return 1;
+}
+
+/*
+ *  Map.prototype and Set.prototype methods
+ */
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_get(duk_hthread *thr) {
+	duk_hmap *m;
+	duk_int_t e_idx;
+	duk_tval *tv_key;
+
+	m = duk__push_this_hmap(thr, 0 /*is_set*/);
+	tv_key = DUK_GET_TVAL_POSIDX(thr, 0);
+	e_idx = duk__hmap_find(m, tv_key, duk__hmap_hash(tv_key));
+	if (e_idx >= 0) {
+		duk_push_tval(thr, m->entries + (duk_uint32_t) e_idx * 2U + 1);
+	} else {
+		duk_push_undefined(thr);
+	}
+	return 1;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_set(duk_hthread *thr) {
+	duk_small_uint_t is_set;
+	duk_hmap *m;
+
+	is_set = (duk_small_uint_t) duk_get_current_magic(thr);
+	m = duk__push_this_hmap(thr, is_set);
+	duk__hmap_put(thr, m, 0, 1);
+	return 1;  /* this */
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_has(duk_hthread *thr) {
+	duk_hmap *m;
+	duk_tval *tv_key;
+
+	m = duk__push_this_hmap(thr, (duk_small_uint_t) duk_get_current_magic(thr));
+	tv_key = DUK_GET_TVAL_POSIDX(thr, 0);
+	duk_push_boolean(thr, duk__hmap_find(m, tv_key, duk__hmap_hash(tv_key)) >= 0);
+	return 1;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_delete(duk_hthread *thr) {
+	duk_hmap *m;
+	duk_tval *tv_key;
+	duk_tval *tv;
+	duk_tval tv_old_key;
+	duk_heaphdr *h_old_val;
+	duk_int_t e_idx;
+	duk_uint32_t stride;
+
+	m = duk__push_this_hmap(thr, (duk_small_uint_t) duk_get_current_magic(thr));
+	tv_key = DUK_GET_TVAL_POSIDX(thr, 0);
+	e_idx = duk__hmap_find(m, tv_key, duk__hmap_hash(tv_key));
+	if (e_idx < 0) {
+		duk_push_false(thr);
+		return 1;
+	}
+
+	/* Leave a tombstone so that entry positions (and thus iterators)
+	 * are not affected, and release the references only after the map
+	 * is in a consistent state.
+	 */
+	stride = DUK_HMAP_GET_STRIDE(m);
+	tv = m->entries + (duk_uint32_t) e_idx * stride;
+	DUK_TVAL_SET_TVAL(&tv_old_key, tv);
+	DUK_TVAL_SET_UNUSED(tv);
+	h_old_val = NULL;
+	if (stride > 1U) {
+		if (DUK_TVAL_IS_HEAP_ALLOCATED(tv + 1)) {
+			h_old_val = DUK_TVAL_GET_HEAPHDR(tv + 1);
+		}
+		DUK_TVAL_SET_UNDEFINED(tv + 1);
+	}
+	DUK_ASSERT(m->count > 0);
+	m->count--;
+	DUK_HMAP_ASSERT_VALID(m);
+
+	DUK_TVAL_DECREF_NORZ(thr, &tv_old_key);
+	DUK_HEAPHDR_DECREF_NORZ_ALLOWNULL(thr, h_old_val);
+	DUK_REFZERO_CHECK_SLOW(thr);
+
+	duk_push_true(thr);
+	return 1;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_clear(duk_hthread *thr) {
+	duk_hmap *m;
+	duk_tval *tv;
+	duk_tval *tv_end;
+
+	m = duk__push_this_hmap(thr, (duk_small_uint_t) duk_get_current_magic(thr));
+
+	if (duk__hmap_gen_observed(m)) {
+		/* Iterators must continue with entries added after the
+		 * clear, so just delete all entries in place.
+		 */
+		duk_uint32_t stride = DUK_HMAP_GET_STRIDE(m);
+
+		tv = m->entries;
+		tv_end = tv + m->e_next * stride;
+		for (; tv < tv_end; tv += stride) {
+			DUK_TVAL_DECREF_NORZ(thr, tv);
+			DUK_TVAL_SET_UNUSED(tv);
+			if (stride > 1U) {
+				DUK_TVAL_DECREF_NORZ(thr, tv + 1);
+				DUK_TVAL_SET_UNDEFINED(tv + 1);
+			}
+		}
+		m->count = 0;
+	} else {
+		duk_tval *entries = m->entries;
+		duk_harray *gen = m->gen;
+
+		tv = entries;
+		tv_end = tv + m->e_next * DUK_HMAP_GET_STRIDE(m);
+		m->entries = NULL;
+		m->gen = NULL;
+		m->e_size = 0;
+		m->e_next = 0;
+		m->count = 0;
+
+		for (; tv < tv_end; tv++) {
+			DUK_TVAL_DECREF_NORZ(thr, tv);
+		}
+		DUK_FREE(thr->heap, (void *) entries);
+		DUK_HOBJECT_DECREF_NORZ_ALLOWNULL(thr, (duk_hobject *) gen);
+	}
+	DUK_HMAP_ASSERT_VALID(m);
+	DUK_REFZERO_CHECK_SLOW(thr);
+	return 0;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_size(duk_hthread *thr) {
+	duk_hmap *m;
+
+	m = duk__push_this_hmap(thr, (duk_small_uint_t) duk_get_current_magic(thr));
+	duk_push_uint(thr, (duk_uint_t) m->count);
+	return 1;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_foreach(duk_hthread *thr) {
+	duk_hmap *m;
+	duk_harray *gen;
+	duk_uint32_t pos = 0;
+	duk_uint32_t stride;
+
+	/* [ callback thisArg ] */
+	m = duk__push_this_hmap(thr, (duk_small_uint_t) duk_get_current_magic(thr));
+	duk_require_callable(thr, 0);
+	stride = DUK_HMAP_GET_STRIDE(m);
+
+	/* 3: generation record, keeps callback mutations trackable */
+	duk_push_hobject(thr, (duk_hobject *) duk__hmap_observe(thr, m));
+
+	for (;;) {
+		duk_tval *tv;
+
+		gen = (duk_harray *) duk_known_hobject(thr, 3);
+		if (gen != m->gen) {
+			pos = duk__hmap_sync_pos(thr, m, gen, pos);
+			duk_push_hobject(thr, (duk_hobject *) m->gen);
+			duk_replace(thr, 3);
+		}
+		while (pos < m->e_next && DUK_TVAL_IS_UNUSED(m->entries + pos * stride)) {
+			pos++;
+		}
+		if (pos >= m->e_next) {
+			break;
+		}
+
+		tv = m->entries + pos * stride;
+		pos++;
+		duk_dup_0(thr);
+		duk_dup_1(thr);
+		duk_push_tval(thr, tv + stride - 1);  /* value; key for a Set */
+		duk_push_tval(thr, tv);
+		duk_dup_2(thr);
+		duk_call_method(thr, 3);
+		duk_pop_unsafe(thr);
+	}
+	return 0;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_map_prototype_iter(duk_hthread *thr) {
+	duk_small_uint_t magic;
+	duk_small_uint_t is_set;
+	duk_hmap *m;
+
+	magic = (duk_small_uint_t) duk_get_current_magic(thr);
+	is_set = magic & DUK__ITER_MAGIC_SET;
+	m = duk__push_this_hmap(thr, is_set);
+
+	(void) duk_push_object_helper(thr,
+	                              DUK_HOBJECT_FLAG_EXTENSIBLE |
+	                              DUK_HOBJECT_FLAG_FASTREFS |
+	                              DUK_HOBJECT_CLASS_AS_FLAGS(DUK_HOBJECT_CLASS_OBJECT),
+	                              is_set ? DUK_BIDX_SET_ITERATOR_PROTOTYPE : DUK_BIDX_MAP_ITERATOR_PROTOTYPE);
+	duk_dup_0(thr);
+	duk_xdef_prop_stridx_short(thr, 1, DUK_STRIDX_INT_TARGET, DUK_PROPDESC_FLAGS_W);
+	duk_push_hobject(thr, (duk_hobject *) duk__hmap_observe(thr, m));
+	duk_xdef_prop_stridx_short(thr, 1, DUK_STRIDX_INT_GEN, DUK_PROPDESC_FLAGS_W);
+	duk_push_uint(thr, 0);
+	duk_xdef_prop_stridx_short(thr, 1, DUK_STRIDX_INT_NEXT, DUK_PROPDESC_FLAGS_W);
+	duk_push_uint(thr, (duk_uint_t) (magic >> DUK__ITER_MAGIC_KIND_SHIFT));
+	duk_xdef_prop_stridx_short(thr, 1, DUK_STRIDX_INT_KIND, DUK_PROPDESC_FLAGS_NONE);
+	return 1;
+}
+
+/*
+ *  %MapIteratorPrototype%.next(), %SetIteratorPrototype%.next()
+ */
+
+DUK_INTERNAL duk_ret_t duk_bi_map_iterator_prototype_next(duk_hthread *thr) {
+	duk_small_uint_t is_set;
+	duk_small_uint_t kind;
+	duk_hobject *h_iter;
+	duk_hmap *m;
+	duk_harray *gen;
+	duk_tval *tv_next;
+	duk_tval *tv;
+	duk_uint32_t pos;
+	duk_uint32_t stride;
+
+	is_set = (duk_small_uint_t) duk_get_current_magic(thr);
+
+	/* [ ] -> [ this target gen kind ] */
+	duk_push_this(thr);
+	h_iter = duk_get_hobject(thr, 0);
+	if (h_iter == NULL || !duk_xget_owndataprop_stridx_short(thr, 0, DUK_STRIDX_INT_TARGET)) {
+		goto type_error;
+	}
+	if (duk_is_undefined(thr, 1)) {
+		duk__push_iter_result(thr, 1 /*done*/);
+		return 1;
+	}
+	m = (duk_hmap *) duk_require_hobject_with_class(thr, 1, is_set ? DUK_HOBJECT_CLASS_SET : DUK_HOBJECT_CLASS_MAP);
+	(void) duk_xget_owndataprop_stridx_short(thr, 0, DUK_STRIDX_INT_GEN);
+	(void) duk_xget_owndataprop_stridx_short(thr, 0, DUK_STRIDX_INT_KIND);
+	gen = (duk_harray *) duk_known_hobject(thr, 2);
+	kind = (duk_small_uint_t) duk_get_uint(thr, 3);
+
+	tv_next = duk_hobject_find_entry_tval_ptr_stridx(thr->heap, h_iter, DUK_STRIDX_INT_NEXT);
+	if (tv_next == NULL || !DUK_TVAL_IS_NUMBER(tv_next)) {
+		goto type_error;
+	}
+	pos = (duk_uint32_t) DUK_TVAL_GET_NUMBER(tv_next);
+	if (gen != m->gen) {
+		pos = duk__hmap_sync_pos(thr, m, gen, pos);
+		duk_push_hobject(thr, (duk_hobject *) m->gen);
+		duk_xdef_prop_stridx_short(thr, 0, DUK_STRIDX_INT_GEN, DUK_PROPDESC_FLAGS_W);
+	}
+
+	stride = DUK_HMAP_GET_STRIDE(m);
+	while (pos < m->e_next && DUK_TVAL_IS_UNUSED(m->entries + pos * stride)) {
+		pos++;
+	}
+	if (pos >= m->e_next) {
+		/* Exhausted: release the Map so that it's no longer tracked,
+		 * further calls keep returning done.
+		 */
+		duk_push_undefined(thr);
+		duk_xdef_prop_stridx_short(thr, 0, DUK_STRIDX_INT_TARGET, DUK_PROPDESC_FLAGS_W);
+		duk_push_undefined(thr);
+		duk_xdef_prop_stridx_short(thr, 0, DUK_STRIDX_INT_GEN, DUK_PROPDESC_FLAGS_W);
+		duk_push_undefined(thr);
+		duk__push_iter_result(thr, 1 /*done*/);
+		return 1;
+	}
+
+	/* Property table may have been resized above, look up again. */
+	tv_next = duk_hobject_find_entry_tval_ptr_stridx(thr->heap, h_iter, DUK_STRIDX_INT_NEXT);
+	DUK_ASSERT(tv_next != NULL);
+	DUK_TVAL_SET_U32(tv_next, pos + 1U);
+
+	tv = m->entries + pos * stride;
+	if (kind == DUK__KIND_KEYS) {
+		duk_push_tval(thr, tv);
+	} else if (kind == DUK__KIND_VALUES) {
+		duk_push_tval(thr, tv + stride - 1);
+	} else {
+		duk_push_tval(thr, tv);
+		duk_push_tval(thr, tv + stride - 1);
+		duk_pack(thr, 2);
+	}
+	duk__push_iter_result(thr, 0 /*done*/);
+	return 1;
+
+ type_error:
+	DUK_ERROR_TYPE(thr, DUK_STR_UNEXPECTED_TYPE);
+	DUK_WO_NORETURN(return 0;);
+}
+
+/* %IteratorPrototype%[@@iterator]() */
+DUK_INTERNAL duk_ret_t duk_bi_iterator_prototype_iterator(duk_hthread *thr) {
+	duk_push_this(thr);
+	return 1;
+}
+
+/*
+ *  WeakMap and WeakSet
+ */
+
+/* Push the Symbol keying entries of 'this' WeakMap or WeakSet. */
+DUK_LOCAL duk_hstring *duk__weakmap_push_this_symbol(duk_hthread *thr, duk_small_uint_t is_set) {
+	duk_hobject *h_this;
+	duk_tval *tv;
+	duk_hstring *h_sym;
+
+	duk_push_this(thr);
+	h_this = duk_get_hobject(thr, -1);
+	if (h_this != NULL) {
+		tv = duk_hobject_find_entry_tval_ptr_stridx(thr->heap, h_this, DUK_STRIDX_INT_VALUE);
+		if (tv != NULL && DUK_TVAL_IS_STRING(tv)) {
+			h_sym = DUK_TVAL_GET_STRING(tv);
+			if (DUK_HSTRING_GET_BYTELEN(h_sym) > DUK__WEAK_PREFIX_LEN &&
+			    duk_memcmp((const void *) DUK_HSTRING_GET_DATA(h_sym),
+			               (const void *) duk__weak_prefix[is_set],
+			               (duk_size_t) DUK__WEAK_PREFIX_LEN) == 0) {
+				duk_push_hstring(thr, h_sym);
+				return h_sym;
+			}
+		}
+	}
+	DUK_ERROR_TYPE(thr, DUK_STR_UNEXPECTED_TYPE);
+	DUK_WO_NORETURN(return NULL;);
+}
+
+/* Key object of a WeakMap entry, NULL if the value can't be a key. */
+DUK_LOCAL duk_hobject *duk__weakmap_get_key(duk_hthread *thr, duk_idx_t idx) {
+	duk_hobject *h_key;
+
+	h_key = duk_get_hobject(thr, idx);
+	if (h_key != NULL && DUK_HEAPHDR_HAS_READONLY((duk_heaphdr *) h_key)) {
+		/* ROM objects can't hold entries. */
+		h_key = NULL;
+	}
+	return h_key;
+}
+
+DUK_LOCAL void duk__weakmap_put(duk_hthread *thr, duk_hstring *h_sym, duk_idx_t idx_key, duk_idx_t idx_val) {
+	duk_hobject *h_key;
+
+	h_key = duk__weakmap_get_key(thr, idx_key);
+	if (h_key == NULL) {
+		DUK_ERROR_TYPE_INVALID_ARGS(thr);
+		DUK_WO_NORETURN(return;);
+	}
+	duk_dup(thr, idx_val);
+	duk_hobject_define_property_internal(thr, h_key, h_sym, DUK_PROPDESC_FLAGS_NONE);
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_weakmap_constructor(duk_hthread *thr) {
+	duk_small_uint_t is_set;
+	char buf[DUK__WEAK_PREFIX_LEN + 2 * 8 + 2];
+	duk_size_t len;
+
+	duk_require_constructor_call(thr);
+	is_set = (duk_small_uint_t) duk_get_current_magic(thr);
+
+	(void) duk_push_object_helper(thr,
+	                              DUK_HOBJECT_FLAG_EXTENSIBLE |
+	                              DUK_HOBJECT_FLAG_FASTREFS |
+	                              DUK_HOBJECT_CLASS_AS_FLAGS(DUK_HOBJECT_CLASS_OBJECT),
+	                              is_set ? DUK_BIDX_WEAKSET_PROTOTYPE : DUK_BIDX_WEAKMAP_PROTOTYPE);
+
+	/* Unique hidden Symbol, shares the counter with Symbol(). */
+	if (++thr->heap->sym_counter[0] == 0) {
+		thr->heap->sym_counter[1]++;
+	}
+	duk_memcpy((void *) buf, (const void *) duk__weak_prefix[is_set], (size_t) DUK__WEAK_PREFIX_LEN);
+	len = DUK__WEAK_PREFIX_LEN;
+	len += (duk_size_t) DUK_SPRINTF(buf + DUK__WEAK_PREFIX_LEN, "%lx-%lx",
+	                                (unsigned long) thr->heap->sym_counter[1],
+	                                (unsigned long) thr->heap->sym_counter[0]);
+	duk_push_lstring(thr, (const char *) buf, len);
+	duk_xdef_prop_stridx_short(thr, 1, DUK_STRIDX_INT_VALUE, DUK_PROPDESC_FLAGS_NONE);
+
+	if (!duk_is_null_or_undefined(thr, 0)) {
+		duk__map_fill(thr, is_set, 1 /*is_weak*/);
+	}
+	return 1;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_weakmap_prototype_get(duk_hthread *thr) {
+	duk_hstring *h_sym;
+	duk_hobject *h_key;
+	duk_tval *tv;
+
+	h_sym = duk__weakmap_push_this_symbol(thr, 0 /*is_set*/);
+	h_key = duk__weakmap_get_key(thr, 0);
+	if (h_key != NULL) {
+		tv = duk_hobject_find_entry_tval_ptr(thr->heap, h_key, h_sym);
+		if (tv != NULL) {
+			duk_push_tval(thr, tv);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_weakmap_prototype_set(duk_hthread *thr) {
+	duk_small_uint_t is_set;
+	duk_hstring *h_sym;
+
+	is_set = (duk_small_uint_t) duk_get_current_magic(thr);
+	if (is_set) {
+		duk_set_top(thr, 1);
+		duk_push_true(thr);
+	}
+
+	/* [ key value ] -> [ key value this symbol ] */
+	h_sym = duk__weakmap_push_this_symbol(thr, is_set);
+	duk__weakmap_put(thr, h_sym, 0, 1);
+	duk_pop_unsafe(thr);
+	return 1;  /* this */
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_weakmap_prototype_has(duk_hthread *thr) {
+	duk_hstring *h_sym;
+	duk_hobject *h_key;
+
+	h_sym = duk__weakmap_push_this_symbol(thr, (duk_small_uint_t) duk_get_current_magic(thr));
+	h_key = duk__weakmap_get_key(thr, 0);
+	duk_push_boolean(thr, h_key != NULL && duk_hobject_find_entry_tval_ptr(thr->heap, h_key, h_sym) != NULL);
+	return 1;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_weakmap_prototype_delete(duk_hthread *thr) {
+	duk_hstring *h_sym;
+	duk_hobject *h_key;
+	duk_bool_t found = 0;
+
+	h_sym = duk__weakmap_push_this_symbol(thr, (duk_small_uint_t) duk_get_current_magic(thr));
+	h_key = duk__weakmap_get_key(thr, 0);
+	if (h_key != NULL && duk_hobject_find_entry_tval_ptr(thr->heap, h_key, h_sym) != NULL) {
+		(void) duk_hobject_delprop_raw(thr, h_key, h_sym, DUK_DELPROP_FLAG_FORCE);
+		found = 1;
+	}
+	duk_push_boolean(thr, found);
+	return 1;
+}
+
+#endif  /* DUK_USE_MAP_BUILTIN */
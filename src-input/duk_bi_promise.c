@@ -1,44 +1,932 @@
 /*
  *  Promise built-in
+ *
+ *  Promise instances are ordinary objects with internal properties:
+ *
+ *    _PromiseState  >= 0 while pending, DUK__PROMISE_FULFILLED or
+ *                   DUK__PROMISE_REJECTED once settled.  The pending value
+ *                   is a generation count identifying the resolving function
+ *                   pair allowed to resolve the Promise; resolving bumps the
+ *                   count which implements [[AlreadyResolved]] without a
+ *                   separate record object.
+ *    _Value         Fulfillment value or rejection reason once settled.
+ *    _Reactions     Pending reactions, a flat array of (onFulfilled,
+ *                   onRejected, capability) triples.
+ *
+ *  A capability is either a native Promise, which is resolved directly
+ *  without creating resolving functions, or for foreign constructors an
+ *  array [ promise, resolve, reject ].
+ *
+ *  Pending jobs (the ES PromiseJobs queue) are kept in the heap stash as a
+ *  flat array of (kind, handler, target, argument) quads and are executed
+ *  when the application calls duk_run_jobs().
+ *
+ *  Limitations: @@species is not supported (then() always creates a plain
+ *  Promise), there is no unhandled rejection tracking, and Promise.any()
+ *  rejects with an Error having an 'errors' property because AggregateError
+ *  is not implemented.
  */
 
 #include "duk_internal.h"
 
 #if defined(DUK_USE_PROMISE_BUILTIN)
 
+#define DUK__PROMISE_FULFILLED          (-1)
+#define DUK__PROMISE_REJECTED           (-2)
+#define DUK__PROMISE_GEN_ANY            (-3)  /* resolve if pending, for capabilities */
+
+#define DUK__JOB_FULFILL                0  /* PromiseReactionJob, fulfilled */
+#define DUK__JOB_REJECT                 1  /* PromiseReactionJob, rejected */
+#define DUK__JOB_THENABLE               2  /* PromiseResolveThenableJob */
+#define DUK__JOB_NSLOTS                 4
+
+/* Magic values for Promise.all() and friends. */
+#define DUK__COMBINE_ALL                0
+#define DUK__COMBINE_ALLSETTLED         1
+#define DUK__COMBINE_ANY                2
+#define DUK__COMBINE_RACE               3
+
+/* Magic values for combinator element functions. */
+#define DUK__ELEM_ALL                   0
+#define DUK__ELEM_SETTLED_FULFILLED     1
+#define DUK__ELEM_SETTLED_REJECTED      2
+#define DUK__ELEM_ANY                   3
+
+/* Magic values for Promise.prototype.finally() helpers. */
+#define DUK__FINALLY_THEN               0
+#define DUK__FINALLY_CATCH              1
+#define DUK__FINALLY_VALUE_THUNK        2
+#define DUK__FINALLY_THROWER            3
+
+/*
+ *  Helpers
+ */
+
+/* Get a pointer to the state of a native Promise, NULL if 'h' is not one.
+ * The pointer is only valid until the next side effect.
+ */
+DUK_LOCAL duk_tval *duk__promise_get_state_ptr(duk_hthread *thr, duk_hobject *h) {
+	duk_tval *tv;
+
+	if (h == NULL) {
+		return NULL;
+	}
+	tv = duk_hobject_find_entry_tval_ptr_stridx(thr->heap, h, DUK_STRIDX_INT_PROMISE_STATE);
+	if (tv != NULL && DUK_TVAL_IS_NUMBER(tv)) {
+		return tv;
+	}
+	return NULL;
+}
+
+DUK_LOCAL duk_bool_t duk__promise_is_promise(duk_hthread *thr, duk_idx_t idx) {
+	return (duk__promise_get_state_ptr(thr, duk_get_hobject(thr, idx)) != NULL);
+}
+
+DUK_LOCAL duk_int_t duk__promise_get_state(duk_hthread *thr, duk_idx_t idx) {
+	duk_tval *tv;
+
+	tv = duk__promise_get_state_ptr(thr, duk_known_hobject(thr, idx));
+	DUK_ASSERT(tv != NULL);
+	return (duk_int_t) DUK_TVAL_GET_NUMBER(tv);
+}
+
+DUK_LOCAL void duk__promise_set_state(duk_hthread *thr, duk_idx_t idx, duk_int_t state) {
+	duk_tval *tv;
+
+	/* Number to number, no refcount updates needed. */
+	tv = duk__promise_get_state_ptr(thr, duk_known_hobject(thr, idx));
+	DUK_ASSERT(tv != NULL);
+	DUK_TVAL_SET_NUMBER(tv, (duk_double_t) state);
+}
+
+DUK_LOCAL void duk__promise_init(duk_hthread *thr, duk_idx_t idx) {
+	idx = duk_require_normalize_index(thr, idx);
+	duk_push_int(thr, 0);
+	duk_xdef_prop_stridx_short(thr, idx, DUK_STRIDX_INT_PROMISE_STATE, DUK_PROPDESC_FLAGS_W);
+}
+
+/* Push a new pending Promise inheriting from Promise.prototype. */
+DUK_LOCAL void duk__promise_push_new(duk_hthread *thr) {
+	(void) duk_push_object_helper(thr,
+	                              DUK_HOBJECT_FLAG_EXTENSIBLE |
+	                              DUK_HOBJECT_FLAG_FASTREFS |
+	                              DUK_HOBJECT_CLASS_AS_FLAGS(DUK_HOBJECT_CLASS_OBJECT),
+	                              DUK_BIDX_PROMISE_PROTOTYPE);
+	duk__promise_init(thr, -1);
+}
+
+/* Push an anonymous helper function (resolving functions etc) with an own
+ * 'length' property as user code may observe it.
+ */
+DUK_LOCAL void duk__promise_push_function(duk_hthread *thr, duk_c_function func, duk_idx_t nargs, duk_small_int_t magic) {
+	duk_push_c_function_builtin_noconstruct(thr, func, nargs);
+	duk_set_magic(thr, -1, (duk_int_t) magic);
+	duk_push_int(thr, (duk_int_t) nargs);
+	duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_LENGTH, DUK_PROPDESC_FLAGS_C);
+}
+
+/* Get (or create) the array stored in an internal property of an object:
+ * [ ... ] -> [ ... array ]
+ */
+DUK_LOCAL void duk__promise_push_list(duk_hthread *thr, duk_idx_t idx_obj, duk_small_uint_t stridx) {
+	idx_obj = duk_require_normalize_index(thr, idx_obj);
+	if (!duk_xget_owndataprop_stridx(thr, idx_obj, stridx)) {
+		duk_pop_unsafe(thr);
+		(void) duk_push_harray(thr);
+		duk_dup_top(thr);
+		duk_xdef_prop_stridx(thr, idx_obj, stridx, DUK_PROPDESC_FLAGS_WC);
+	}
+}
+
+/* Append a job to the job queue: [ ... handler target arg ] -> [ ... ] */
+DUK_LOCAL void duk__promise_enqueue_job(duk_hthread *thr, duk_small_int_t kind) {
+	duk_uarridx_t n;
+
+	duk_push_hobject(thr, thr->heap->heap_object);
+	duk__promise_push_list(thr, -1, DUK_STRIDX_INT_JOBS);
+	n = (duk_uarridx_t) duk_get_length(thr, -1);
+
+	/* [ ... handler target arg stash jobs ] */
+	duk_push_int(thr, kind);
+	duk_put_prop_index(thr, -2, n);
+	duk_dup(thr, -5);
+	duk_put_prop_index(thr, -2, n + 1);
+	duk_dup(thr, -4);
+	duk_put_prop_index(thr, -2, n + 2);
+	duk_dup(thr, -3);
+	duk_put_prop_index(thr, -2, n + 3);
+	duk_pop_n(thr, 5);
+}
+
+/* Fulfill or reject a pending Promise and trigger its reactions:
+ * [ ... value ] -> [ ... ]
+ */
+DUK_LOCAL void duk__promise_settle(duk_hthread *thr, duk_idx_t idx_promise, duk_small_int_t kind) {
+	duk_uarridx_t i, n;
+
+	DUK_ASSERT(kind == DUK__JOB_FULFILL || kind == DUK__JOB_REJECT);
+
+	idx_promise = duk_require_normalize_index(thr, idx_promise);
+	duk__promise_set_state(thr, idx_promise, kind == DUK__JOB_FULFILL ? DUK__PROMISE_FULFILLED : DUK__PROMISE_REJECTED);
+	duk_dup_top(thr);
+	duk_xdef_prop_stridx_short(thr, idx_promise, DUK_STRIDX_INT_VALUE, DUK_PROPDESC_FLAGS_NONE);
+
+	if (duk_xget_owndataprop_stridx_short(thr, idx_promise, DUK_STRIDX_INT_REACTIONS)) {
+		/* [ ... value reactions ] */
+		n = (duk_uarridx_t) duk_get_length(thr, -1);
+		for (i = 0; i < n; i += 3) {
+			(void) duk_get_prop_index(thr, -1, i + (duk_uarridx_t) kind);
+			(void) duk_get_prop_index(thr, -2, i + 2);
+			duk_dup(thr, -4);
+			duk__promise_enqueue_job(thr, kind);
+		}
+		(void) duk_del_prop_stridx_short(thr, idx_promise, DUK_STRIDX_INT_REACTIONS);
+	}
+	duk_pop_2_unsafe(thr);
+}
+
+/* Check [[AlreadyResolved]] and lock the Promise if allowed.  'gen' is the
+ * generation of the resolving functions or DUK__PROMISE_GEN_ANY.
+ */
+DUK_LOCAL duk_bool_t duk__promise_lock(duk_hthread *thr, duk_idx_t idx_promise, duk_int_t gen) {
+	duk_int_t state;
+
+	state = duk__promise_get_state(thr, idx_promise);
+	if (state < 0 || (gen != DUK__PROMISE_GEN_ANY && gen != state)) {
+		return 0;
+	}
+	duk__promise_set_state(thr, idx_promise, state + 1);
+	return 1;
+}
+
+DUK_LOCAL duk_ret_t duk__promise_get_then_raw(duk_hthread *thr, void *udata) {
+	DUK_UNREF(udata);
+	(void) duk_get_prop_stridx_short(thr, -1, DUK_STRIDX_THEN);
+	return 1;
+}
+
+/* Promise resolve functions: [ ... resolution ] -> [ ... ] */
+DUK_LOCAL void duk__promise_resolve(duk_hthread *thr, duk_idx_t idx_promise, duk_int_t gen) {
+	idx_promise = duk_require_normalize_index(thr, idx_promise);
+	if (!duk__promise_lock(thr, idx_promise, gen)) {
+		duk_pop_unsafe(thr);
+		return;
+	}
+
+	if (duk_get_hobject(thr, -1) == duk_known_hobject(thr, idx_promise)) {
+		duk_pop_unsafe(thr);
+		(void) duk_push_error_object(thr, DUK_ERR_TYPE_ERROR, "promise resolved with itself");
+		duk__promise_settle(thr, idx_promise, DUK__JOB_REJECT);
+		return;
+	}
+	if (!duk_check_type_mask(thr, -1, DUK_TYPE_MASK_OBJECT | DUK_TYPE_MASK_LIGHTFUNC | DUK_TYPE_MASK_BUFFER)) {
+		duk__promise_settle(thr, idx_promise, DUK__JOB_FULFILL);
+		return;
+	}
+
+	/* Reading .then may invoke a getter which may throw. */
+	duk_dup_top(thr);
+	if (duk_safe_call(thr, duk__promise_get_then_raw, NULL /*udata*/, 1 /*nargs*/, 1 /*nrets*/) != DUK_EXEC_SUCCESS) {
+		duk_remove_m2(thr);
+		duk__promise_settle(thr, idx_promise, DUK__JOB_REJECT);
+		return;
+	}
+	if (!duk_is_callable(thr, -1)) {
+		duk_pop_unsafe(thr);
+		duk__promise_settle(thr, idx_promise, DUK__JOB_FULFILL);
+		return;
+	}
+
+	/* [ ... resolution then ] -> [ ... then promise resolution ] */
+	duk_dup(thr, idx_promise);
+	duk_pull(thr, -3);
+	duk__promise_enqueue_job(thr, DUK__JOB_THENABLE);
+}
+
+/* Promise reject functions: [ ... reason ] -> [ ... ] */
+DUK_LOCAL void duk__promise_reject(duk_hthread *thr, duk_idx_t idx_promise, duk_int_t gen) {
+	idx_promise = duk_require_normalize_index(thr, idx_promise);
+	if (!duk__promise_lock(thr, idx_promise, gen)) {
+		duk_pop_unsafe(thr);
+		return;
+	}
+	duk__promise_settle(thr, idx_promise, DUK__JOB_REJECT);
+}
+
+/* Resolving function, magic 0 = resolve, 1 = reject. */
+DUK_LOCAL duk_ret_t duk__promise_resolving_function(duk_hthread *thr) {
+	duk_int_t gen;
+
+	duk_set_top(thr, 1);
+	duk_push_current_function(thr);
+	(void) duk_xget_owndataprop_stridx_short(thr, 1, DUK_STRIDX_INT_TARGET);
+	(void) duk_xget_owndataprop_stridx_short(thr, 1, DUK_STRIDX_INT_VALUE);
+	gen = duk_get_int(thr, 3);
+
+	/* [ value func promise gen ] */
+	duk_dup_0(thr);
+	if (duk_get_current_magic(thr) == 0) {
+		duk__promise_resolve(thr, 2, gen);
+	} else {
+		duk__promise_reject(thr, 2, gen);
+	}
+	return 0;
+}
+
+/* CreateResolvingFunctions(): [ ... ] -> [ ... resolve reject ] */
+DUK_LOCAL void duk__promise_push_resolving_functions(duk_hthread *thr, duk_idx_t idx_promise) {
+	duk_int_t gen;
+	duk_small_int_t i;
+
+	idx_promise = duk_require_normalize_index(thr, idx_promise);
+	gen = duk__promise_get_state(thr, idx_promise);
+
+	for (i = 0; i < 2; i++) {
+		duk__promise_push_function(thr, duk__promise_resolving_function, 1, i);
+		duk_dup(thr, idx_promise);
+		duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_TARGET, DUK_PROPDESC_FLAGS_NONE);
+		duk_push_int(thr, gen);
+		duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_VALUE, DUK_PROPDESC_FLAGS_NONE);
+	}
+}
+
+/* GetCapabilitiesExecutor function, stores resolve/reject into the
+ * capability record.
+ */
+DUK_LOCAL duk_ret_t duk__promise_capability_executor(duk_hthread *thr) {
+	/* [ resolve reject ] */
+	duk_push_current_function(thr);
+	(void) duk_xget_owndataprop_stridx_short(thr, 2, DUK_STRIDX_INT_TARGET);
+	(void) duk_get_prop_index(thr, 3, 1);
+	(void) duk_get_prop_index(thr, 3, 2);
+	if (!duk_is_undefined(thr, 4) || !duk_is_undefined(thr, 5)) {
+		DUK_ERROR_TYPE(thr, "capability already set");
+		DUK_WO_NORETURN(return 0;);
+	}
+	duk_dup_0(thr);
+	duk_put_prop_index(thr, 3, 1);
+	duk_dup_1(thr);
+	duk_put_prop_index(thr, 3, 2);
+	return 0;
+}
+
+/* NewPromiseCapability(C): [ ... ] -> [ ... promise capability ] */
+DUK_LOCAL void duk__promise_push_capability(duk_hthread *thr, duk_idx_t idx_ctor) {
+	idx_ctor = duk_require_normalize_index(thr, idx_ctor);
+
+	if (duk_get_hobject(thr, idx_ctor) == thr->builtins[DUK_BIDX_PROMISE_CONSTRUCTOR]) {
+		/* Fast path: a native Promise is its own capability. */
+		duk__promise_push_new(thr);
+		duk_dup_top(thr);
+		return;
+	}
+	if (!duk_is_constructable(thr, idx_ctor)) {
+		DUK_ERROR_TYPE(thr, DUK_STR_NOT_CONSTRUCTABLE);
+		DUK_WO_NORETURN(return;);
+	}
+
+	(void) duk_push_harray(thr);
+	duk_dup(thr, idx_ctor);
+	duk__promise_push_function(thr, duk__promise_capability_executor, 2, 0);
+	duk_dup(thr, -3);
+	duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_TARGET, DUK_PROPDESC_FLAGS_NONE);
+	duk_new(thr, 1);
+
+	/* [ ... record promise ] */
+	(void) duk_get_prop_index(thr, -2, 1);
+	(void) duk_get_prop_index(thr, -3, 2);
+	if (!duk_is_callable(thr, -1) || !duk_is_callable(thr, -2)) {
+		DUK_ERROR_TYPE(thr, DUK_STR_NOT_CALLABLE);
+		DUK_WO_NORETURN(return;);
+	}
+	duk_pop_2_unsafe(thr);
+	duk_dup_top(thr);
+	duk_put_prop_index(thr, -3, 0);
+	duk_swap_top(thr, -2);
+}
+
+/* Push resolve and reject functions of a capability:
+ * [ ... ] -> [ ... resolve reject ]
+ */
+DUK_LOCAL void duk__promise_push_capability_functions(duk_hthread *thr, duk_idx_t idx_cap) {
+	idx_cap = duk_require_normalize_index(thr, idx_cap);
+	if (duk__promise_is_promise(thr, idx_cap)) {
+		duk__promise_push_resolving_functions(thr, idx_cap);
+	} else {
+		(void) duk_get_prop_index(thr, idx_cap, 1);
+		(void) duk_get_prop_index(thr, idx_cap, 2);
+	}
+}
+
+/* Resolve or reject a capability: [ ... value ] -> [ ... ] */
+DUK_LOCAL void duk__promise_settle_capability(duk_hthread *thr, duk_idx_t idx_cap, duk_small_int_t kind) {
+	idx_cap = duk_require_normalize_index(thr, idx_cap);
+	if (duk__promise_is_promise(thr, idx_cap)) {
+		if (kind == DUK__JOB_FULFILL) {
+			duk__promise_resolve(thr, idx_cap, DUK__PROMISE_GEN_ANY);
+		} else {
+			duk__promise_reject(thr, idx_cap, DUK__PROMISE_GEN_ANY);
+		}
+		return;
+	}
+
+	(void) duk_get_prop_index(thr, idx_cap, kind == DUK__JOB_FULFILL ? 1 : 2);
+	duk_push_undefined(thr);
+	duk_pull(thr, -3);
+	duk_call_method(thr, 1);
+	duk_pop_unsafe(thr);
+}
+
+/* PerformPromiseThen(): [ ... onFulfilled onRejected capability ] -> [ ... ] */
+DUK_LOCAL void duk__promise_perform_then(duk_hthread *thr, duk_idx_t idx_promise) {
+	duk_int_t state;
+	duk_uarridx_t n;
+
+	idx_promise = duk_require_normalize_index(thr, idx_promise);
+
+	/* Non-callable handlers are replaced with pass-through behavior. */
+	if (!duk_is_callable(thr, -3)) {
+		duk_push_undefined(thr);
+		duk_replace(thr, -4);
+	}
+	if (!duk_is_callable(thr, -2)) {
+		duk_push_undefined(thr);
+		duk_replace(thr, -3);
+	}
+
+	state = duk__promise_get_state(thr, idx_promise);
+	if (state >= 0) {
+		duk__promise_push_list(thr, idx_promise, DUK_STRIDX_INT_REACTIONS);
+		n = (duk_uarridx_t) duk_get_length(thr, -1);
+		duk_dup(thr, -4);
+		duk_put_prop_index(thr, -2, n);
+		duk_dup(thr, -3);
+		duk_put_prop_index(thr, -2, n + 1);
+		duk_dup(thr, -2);
+		duk_put_prop_index(thr, -2, n + 2);
+		duk_pop_n_unsafe(thr, 4);
+	} else {
+		/* [ ... onFulfilled onRejected capability ] -> [ ... handler capability value ] */
+		if (state == DUK__PROMISE_FULFILLED) {
+			duk_remove_m2(thr);
+		} else {
+			duk_remove(thr, -3);
+		}
+		(void) duk_xget_owndataprop_stridx_short(thr, idx_promise, DUK_STRIDX_INT_VALUE);
+		duk__promise_enqueue_job(thr, state == DUK__PROMISE_FULFILLED ? DUK__JOB_FULFILL : DUK__JOB_REJECT);
+	}
+}
+
+DUK_LOCAL duk_bool_t duk__promise_is_builtin_then(duk_hobject *h) {
+	return (h != NULL && DUK_HOBJECT_IS_NATFUNC(h) &&
+	        ((duk_hnatfunc *) h)->func == duk_bi_promise_then);
+}
+
+/* Run a single job: [ kind handler target argument ] */
+DUK_LOCAL duk_ret_t duk__promise_run_job(duk_hthread *thr) {
+	duk_small_int_t kind;
+
+	kind = (duk_small_int_t) duk_get_int(thr, 0);
+	if (kind == DUK__JOB_THENABLE) {
+		/* [ kind then promise thenable ] */
+		if (duk__promise_is_promise(thr, 3) && duk__promise_is_builtin_then(duk_get_hobject(thr, 1))) {
+			/* A native Promise using the built-in then(): chain directly
+			 * without resolving functions or a throwaway derived Promise,
+			 * the difference is not observable.
+			 */
+			duk_push_undefined(thr);
+			duk_push_undefined(thr);
+			duk_dup(thr, 2);
+			duk__promise_perform_then(thr, 3);
+			return 0;
+		}
+
+		duk__promise_push_resolving_functions(thr, 2);
+		duk_dup(thr, 1);
+		duk_dup(thr, 3);
+		duk_dup(thr, 4);
+		duk_dup(thr, 5);
+		if (duk_pcall_method(thr, 2) != DUK_EXEC_SUCCESS) {
+			/* [ kind then promise thenable resolve reject err ] */
+			duk_dup(thr, 5);
+			duk_push_undefined(thr);
+			duk_pull(thr, -3);
+			duk_call_method(thr, 1);
+		}
+		return 0;
+	}
+
+	/* [ kind handler capability argument ] */
+	if (duk_is_undefined(thr, 1)) {
+		duk_dup(thr, 3);
+	} else {
+		duk_dup(thr, 1);
+		duk_push_undefined(thr);
+		duk_dup(thr, 3);
+		kind = (duk_pcall_method(thr, 1) == DUK_EXEC_SUCCESS ? DUK__JOB_FULFILL : DUK__JOB_REJECT);
+	}
+	if (!duk_is_undefined(thr, 2)) {
+		duk__promise_settle_capability(thr, 2, kind);
+	}
+	return 0;
+}
+
+/* PromiseResolve(C, x): [ ... x ] -> [ ... promise ] */
+DUK_LOCAL void duk__promise_resolve_with_ctor(duk_hthread *thr, duk_idx_t idx_ctor) {
+	idx_ctor = duk_require_normalize_index(thr, idx_ctor);
+
+	if (duk__promise_is_promise(thr, -1)) {
+		(void) duk_get_prop_stridx_short(thr, -1, DUK_STRIDX_CONSTRUCTOR);
+		if (duk_samevalue(thr, -1, idx_ctor)) {
+			duk_pop_unsafe(thr);
+			return;
+		}
+		duk_pop_unsafe(thr);
+	}
+
+	duk__promise_push_capability(thr, idx_ctor);
+	duk_pull(thr, -3);
+	duk__promise_settle_capability(thr, -2, DUK__JOB_FULFILL);
+	duk_pop_unsafe(thr);
+}
+
+#endif  /* DUK_USE_PROMISE_BUILTIN */
+
+/*
+ *  Job queue
+ */
+
+DUK_EXTERNAL void duk_run_jobs(duk_hthread *thr) {
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	duk_uarridx_t i, n;
+	duk_small_uint_t j;
+#endif
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+#if defined(DUK_USE_PROMISE_BUILTIN)
+	for (;;) {
+		duk_push_hobject(thr, thr->heap->heap_object);
+		if (!duk_xget_owndataprop_stridx_short(thr, -1, DUK_STRIDX_INT_JOBS)) {
+			duk_pop_2_unsafe(thr);
+			break;
+		}
+		duk_push_c_function_builtin_noconstruct(thr, duk__promise_run_job, DUK__JOB_NSLOTS);
+
+		/* Detach the current batch so that jobs enqueued while running
+		 * it go into a fresh queue which is processed next.
+		 */
+		(void) duk_del_prop_stridx_short(thr, -3, DUK_STRIDX_INT_JOBS);
+		n = (duk_uarridx_t) duk_get_length(thr, -2);
+
+		/* [ ... stash jobs runner ] */
+		for (i = 0; i < n; i += DUK__JOB_NSLOTS) {
+			duk_dup_top(thr);
+			for (j = 0; j < DUK__JOB_NSLOTS; j++) {
+				(void) duk_get_prop_index(thr, -3 - (duk_idx_t) j, i + j);
+			}
+			/* Errors thrown by a job are ignored (HostReportErrors). */
+			(void) duk_pcall(thr, DUK__JOB_NSLOTS);
+			duk_pop_unsafe(thr);
+		}
+		duk_pop_n_unsafe(thr, 3);
+	}
+#else
+	DUK_UNREF(thr);
+#endif  /* DUK_USE_PROMISE_BUILTIN */
+}
+
+#if defined(DUK_USE_PROMISE_BUILTIN)
+
+/*
+ *  Constructor
+ */
+
 DUK_INTERNAL duk_ret_t duk_bi_promise_constructor(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	duk_require_constructor_call(thr);
+	duk_require_callable(thr, 0);
+
+	/* Default instance inherits from NewTarget.prototype. */
+	duk_push_this(thr);
+	duk__promise_init(thr, 1);
+	duk__promise_push_resolving_functions(thr, 1);
+
+	/* [ executor promise resolve reject ] */
+	duk_dup_0(thr);
+	duk_push_undefined(thr);
+	duk_dup(thr, 2);
+	duk_dup(thr, 3);
+	if (duk_pcall_method(thr, 2) != DUK_EXEC_SUCCESS) {
+		duk__promise_reject(thr, 1, 0 /*gen*/);
+	} else {
+		duk_pop_unsafe(thr);
+	}
+	duk_dup_1(thr);
+	return 1;
+}
+
+/*
+ *  Promise.all(), Promise.allSettled(), Promise.any(), Promise.race()
+ */
+
+/* Settle the combined Promise once all elements are done:
+ * record is [ values, remaining, settle function, called flags ].
+ */
+DUK_LOCAL void duk__promise_combinator_finish(duk_hthread *thr, duk_idx_t idx_record, duk_bool_t is_any) {
+	(void) duk_get_prop_index(thr, idx_record, 2);
+	duk_push_undefined(thr);
+	if (is_any) {
+		(void) duk_push_error_object(thr, DUK_ERR_ERROR, "all promises were rejected");
+		duk_push_literal(thr, "errors");
+		(void) duk_get_prop_index(thr, idx_record, 0);
+		duk_def_prop(thr, -3, DUK_DEFPROP_HAVE_VALUE | DUK_DEFPROP_SET_WRITABLE | DUK_DEFPROP_SET_CONFIGURABLE);
+	} else {
+		(void) duk_get_prop_index(thr, idx_record, 0);
+	}
+	duk_call_method(thr, 1);
+	duk_pop_unsafe(thr);
+}
+
+DUK_LOCAL duk_ret_t duk__promise_element_function(duk_hthread *thr) {
+	duk_small_int_t kind;
+	duk_uarridx_t index;
+	duk_int_t remaining;
+
+	kind = (duk_small_int_t) duk_get_current_magic(thr);
+
+	duk_set_top(thr, 1);
+	duk_push_current_function(thr);
+	(void) duk_xget_owndataprop_stridx_short(thr, 1, DUK_STRIDX_INT_TARGET);
+	(void) duk_xget_owndataprop_stridx_short(thr, 1, DUK_STRIDX_INT_VALUE);
+	index = (duk_uarridx_t) duk_get_uint(thr, 3);
+
+	/* [[AlreadyCalled]], shared by the allSettled() function pair. */
+	(void) duk_get_prop_index(thr, 2, 3);
+	(void) duk_get_prop_index(thr, 4, index);
+	if (duk_to_boolean(thr, -1)) {
+		return 0;
+	}
+	duk_pop_unsafe(thr);
+	duk_push_true(thr);
+	duk_put_prop_index(thr, 4, index);
+
+	/* [ x func record index called ] */
+	(void) duk_get_prop_index(thr, 2, 0);
+	if (kind == DUK__ELEM_SETTLED_FULFILLED || kind == DUK__ELEM_SETTLED_REJECTED) {
+		duk_push_object(thr);
+		duk_push_string(thr, kind == DUK__ELEM_SETTLED_FULFILLED ? "fulfilled" : "rejected");
+		duk_put_prop_literal(thr, -2, "status");
+		duk_dup_0(thr);
+		if (kind == DUK__ELEM_SETTLED_FULFILLED) {
+			duk_put_prop_stridx_short(thr, -2, DUK_STRIDX_VALUE);
+		} else {
+			duk_put_prop_literal(thr, -2, "reason");
+		}
+	} else {
+		duk_dup_0(thr);
+	}
+	duk_put_prop_index(thr, 5, index);
+
+	(void) duk_get_prop_index(thr, 2, 1);
+	remaining = duk_get_int(thr, -1) - 1;
+	duk_pop_unsafe(thr);
+	duk_push_int(thr, remaining);
+	duk_put_prop_index(thr, 2, 1);
+	if (remaining == 0) {
+		duk__promise_combinator_finish(thr, 2, kind == DUK__ELEM_ANY);
+	}
+	return 0;
+}
+
+DUK_LOCAL void duk__promise_push_element_function(duk_hthread *thr, duk_small_int_t kind, duk_idx_t idx_record, duk_uarridx_t index) {
+	duk__promise_push_function(thr, duk__promise_element_function, 1, kind);
+	duk_dup(thr, idx_record);
+	duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_TARGET, DUK_PROPDESC_FLAGS_NONE);
+	duk_push_uint(thr, (duk_uint_t) index);
+	duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_VALUE, DUK_PROPDESC_FLAGS_NONE);
+}
+
+/* Iterate and register element reactions, errors reject the result:
+ * [ iterable C resolve reject ], magic is DUK__COMBINE_xxx.
+ */
+DUK_LOCAL duk_ret_t duk__promise_combinator_iterate(duk_hthread *thr) {
+	duk_small_int_t kind;
+	duk_bool_t use_iterator;
+	duk_uarridx_t index;
+	duk_uarridx_t len = 0;
+	duk_int_t remaining;
+
+	kind = (duk_small_int_t) duk_get_current_magic(thr);
+
+	(void) duk_get_prop_stridx_short(thr, 1, DUK_STRIDX_RESOLVE);  /* 4: promiseResolve */
+	duk_require_callable(thr, 4);
+
+	/* 5: shared record [ values, remaining, settle function, called flags ] */
+	(void) duk_push_harray(thr);
+	(void) duk_push_harray(thr);
+	duk_put_prop_index(thr, 5, 0);
+	duk_push_int(thr, 1);
+	duk_put_prop_index(thr, 5, 1);
+	duk_dup(thr, kind == DUK__COMBINE_ANY ? 3 : 2);
+	duk_put_prop_index(thr, 5, 2);
+	(void) duk_push_harray(thr);
+	duk_put_prop_index(thr, 5, 3);
+
+	/* Use the iterator protocol when the value is iterable, otherwise
+	 * fall back to array-like iteration (Symbol.iterator is not yet
+	 * provided by all built-ins).
+	 */
+	if (duk_is_null_or_undefined(thr, 0)) {
+		DUK_ERROR_TYPE(thr, DUK_STR_NOT_OBJECT_COERCIBLE);
+		DUK_WO_NORETURN(return 0;);
+	}
+	use_iterator = duk_get_method_stridx(thr, 0, DUK_STRIDX_WELLKNOWN_SYMBOL_ITERATOR);
+	if (use_iterator) {
+		duk_dup_0(thr);
+		duk_call_method(thr, 0);  /* 6: iterator */
+		if (!duk_is_object(thr, 6)) {
+			DUK_ERROR_TYPE(thr, DUK_STR_NOT_OBJECT);
+			DUK_WO_NORETURN(return 0;);
+		}
+		(void) duk_get_prop_literal(thr, 6, "next");  /* 7: next method */
+	} else {
+		duk_push_undefined(thr);
+		duk_push_undefined(thr);
+		(void) duk_get_prop_stridx_short(thr, 0, DUK_STRIDX_LENGTH);
+		len = (duk_uarridx_t) duk_to_uint32(thr, -1);
+		duk_pop_unsafe(thr);
+	}
+
+	for (index = 0; ; index++) {
+		/* 8: next value */
+		if (use_iterator) {
+			duk_dup(thr, 7);
+			duk_dup(thr, 6);
+			duk_call_method(thr, 0);
+			if (!duk_is_object(thr, 8)) {
+				DUK_ERROR_TYPE(thr, DUK_STR_NOT_OBJECT);
+				DUK_WO_NORETURN(return 0;);
+			}
+			(void) duk_get_prop_literal(thr, 8, "done");
+			if (duk_to_boolean(thr, -1)) {
+				duk_pop_2_unsafe(thr);
+				break;
+			}
+			duk_pop_unsafe(thr);
+			(void) duk_get_prop_stridx_short(thr, 8, DUK_STRIDX_VALUE);
+			duk_remove(thr, 8);
+		} else {
+			if (index >= len) {
+				break;
+			}
+			(void) duk_get_prop_index(thr, 0, index);
+		}
+
+		/* nextPromise = promiseResolve.call(C, value) */
+		duk_dup(thr, 4);
+		duk_dup_1(thr);
+		duk_pull(thr, 8);
+		duk_call_method(thr, 1);
+
+		(void) duk_get_prop_stridx_short(thr, 8, DUK_STRIDX_THEN);
+		duk_dup(thr, 8);
+		switch (kind) {
+		case DUK__COMBINE_ALL:
+			duk__promise_push_element_function(thr, DUK__ELEM_ALL, 5, index);
+			duk_dup(thr, 3);
+			break;
+		case DUK__COMBINE_ALLSETTLED:
+			duk__promise_push_element_function(thr, DUK__ELEM_SETTLED_FULFILLED, 5, index);
+			duk__promise_push_element_function(thr, DUK__ELEM_SETTLED_REJECTED, 5, index);
+			/* Share [[AlreadyCalled]] by using the same index. */
+			break;
+		case DUK__COMBINE_ANY:
+			duk_dup_2(thr);
+			duk__promise_push_element_function(thr, DUK__ELEM_ANY, 5, index);
+			break;
+		default:  /* DUK__COMBINE_RACE */
+			duk_dup_2(thr);
+			duk_dup(thr, 3);
+			break;
+		}
+		if (kind != DUK__COMBINE_RACE) {
+			(void) duk_get_prop_index(thr, 5, 0);
+			duk_push_undefined(thr);
+			duk_put_prop_index(thr, -2, index);
+			duk_pop_unsafe(thr);
+			(void) duk_get_prop_index(thr, 5, 1);
+			remaining = duk_get_int(thr, -1) + 1;
+			duk_pop_unsafe(thr);
+			duk_push_int(thr, remaining);
+			duk_put_prop_index(thr, 5, 1);
+		}
+		duk_call_method(thr, 2);
+		duk_pop_2_unsafe(thr);
+	}
+
+	if (kind != DUK__COMBINE_RACE) {
+		(void) duk_get_prop_index(thr, 5, 1);
+		remaining = duk_get_int(thr, -1) - 1;
+		duk_pop_unsafe(thr);
+		duk_push_int(thr, remaining);
+		duk_put_prop_index(thr, 5, 1);
+		if (remaining == 0) {
+			duk__promise_combinator_finish(thr, 5, kind == DUK__COMBINE_ANY);
+		}
+	}
+	return 0;
+}
+
+DUK_LOCAL duk_ret_t duk__promise_combinator(duk_hthread *thr, duk_small_int_t kind) {
+	duk_set_top(thr, 1);
+	duk_push_this(thr);
+	duk__promise_push_capability(thr, 1);
+	duk__promise_push_capability_functions(thr, 3);
+
+	/* [ iterable C promise capability resolve reject ] */
+	duk_push_c_function_builtin_noconstruct(thr, duk__promise_combinator_iterate, 4);
+	duk_set_magic(thr, -1, (duk_int_t) kind);
+	duk_dup_0(thr);
+	duk_dup_1(thr);
+	duk_dup(thr, 4);
+	duk_dup(thr, 5);
+	if (duk_pcall(thr, 4) != DUK_EXEC_SUCCESS) {
+		/* IfAbruptRejectPromise() */
+		duk_dup(thr, 5);
+		duk_push_undefined(thr);
+		duk_pull(thr, -3);
+		duk_call_method(thr, 1);
+	}
+	duk_dup_2(thr);
+	return 1;
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_promise_all(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	return duk__promise_combinator(thr, (duk_small_int_t) duk_get_current_magic(thr));
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_promise_race(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	return duk__promise_combinator(thr, DUK__COMBINE_RACE);
 }
 
+/*
+ *  Promise.reject(), Promise.resolve()
+ */
+
 DUK_INTERNAL duk_ret_t duk_bi_promise_reject(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	duk_push_this(thr);
+	duk__promise_push_capability(thr, 1);
+
+	/* [ reason C promise capability ] */
+	duk_dup_0(thr);
+	duk__promise_settle_capability(thr, 3, DUK__JOB_REJECT);
+	duk_dup_2(thr);
+	return 1;
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_promise_resolve(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	duk_push_this(thr);
+	if (!duk_is_object(thr, 1)) {
+		DUK_ERROR_TYPE(thr, DUK_STR_NOT_OBJECT);
+		DUK_WO_NORETURN(return 0;);
+	}
+	duk_dup_0(thr);
+	duk__promise_resolve_with_ctor(thr, 1);
+	return 1;
 }
 
+/*
+ *  Promise.prototype.catch(), Promise.prototype.finally(),
+ *  Promise.prototype.then()
+ */
+
 DUK_INTERNAL duk_ret_t duk_bi_promise_catch(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	/* Invoke(promise, 'then', undefined, onRejected) */
+	duk_push_this(thr);
+	(void) duk_get_prop_stridx_short(thr, 1, DUK_STRIDX_THEN);
+	duk_dup_1(thr);
+	duk_push_undefined(thr);
+	duk_dup_0(thr);
+	duk_call_method(thr, 2);
+	return 1;
+}
+
+/* Helpers for finally(), see DUK__FINALLY_xxx for magic values. */
+DUK_LOCAL duk_ret_t duk__promise_finally_function(duk_hthread *thr) {
+	duk_small_int_t kind;
+
+	kind = (duk_small_int_t) duk_get_current_magic(thr);
+
+	duk_set_top(thr, 1);
+	duk_push_current_function(thr);
+	if (kind == DUK__FINALLY_VALUE_THUNK || kind == DUK__FINALLY_THROWER) {
+		(void) duk_xget_owndataprop_stridx_short(thr, 1, DUK_STRIDX_INT_VALUE);
+		if (kind == DUK__FINALLY_THROWER) {
+			(void) duk_throw(thr);
+			DUK_WO_NORETURN(return 0;);
+		}
+		return 1;
+	}
+
+	/* [ value func ] */
+	(void) duk_xget_owndataprop_stridx_short(thr, 1, DUK_STRIDX_INT_TARGET);
+	duk_call(thr, 0);
+	duk_push_hobject(thr, thr->builtins[DUK_BIDX_PROMISE_CONSTRUCTOR]);
+	duk_swap(thr, 2, 3);
+	duk__promise_resolve_with_ctor(thr, 2);
+
+	/* [ value func C promise ] */
+	(void) duk_get_prop_stridx_short(thr, 3, DUK_STRIDX_THEN);
+	duk_dup(thr, 3);
+	duk__promise_push_function(thr, duk__promise_finally_function, 0, kind + DUK__FINALLY_VALUE_THUNK);
+	duk_dup_0(thr);
+	duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_VALUE, DUK_PROPDESC_FLAGS_NONE);
+	duk_call_method(thr, 1);
+	return 1;
+}
+
+DUK_INTERNAL duk_ret_t duk_bi_promise_finally(duk_hthread *thr) {
+	duk_small_int_t i;
+
+	duk_push_this(thr);
+	if (!duk_is_object(thr, 1)) {
+		DUK_ERROR_TYPE(thr, DUK_STR_NOT_OBJECT);
+		DUK_WO_NORETURN(return 0;);
+	}
+
+	/* [ onFinally promise ] */
+	(void) duk_get_prop_stridx_short(thr, 1, DUK_STRIDX_THEN);
+	duk_dup_1(thr);
+	if (duk_is_callable(thr, 0)) {
+		for (i = DUK__FINALLY_THEN; i <= DUK__FINALLY_CATCH; i++) {
+			duk__promise_push_function(thr, duk__promise_finally_function, 1, i);
+			duk_dup_0(thr);
+			duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_TARGET, DUK_PROPDESC_FLAGS_NONE);
+		}
+	} else {
+		duk_dup_0(thr);
+		duk_dup_0(thr);
+	}
+	duk_call_method(thr, 2);
+	return 1;
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_promise_then(duk_hthread *thr) {
-	DUK_ERROR_TYPE(thr, "unimplemented");
-	DUK_WO_NORETURN(return 0;);
+	duk_push_this(thr);
+	if (!duk__promise_is_promise(thr, 2)) {
+		DUK_ERROR_TYPE(thr, "not a Promise");
+		DUK_WO_NORETURN(return 0;);
+	}
+
+	/* @@species is not supported, the result is always a plain Promise. */
+	duk__promise_push_new(thr);
+
+	/* [ onFulfilled onRejected promise derived ] */
+	duk_dup_0(thr);
+	duk_dup_1(thr);
+	duk_dup(thr, 3);
+	duk__promise_perform_then(thr, 2);
+	return 1;
 }
 
 #endif  /* DUK_USE_PROMISE_BUILTIN */
@@ -1156,9 +1156,14 @@ DUK_INTERNAL duk_ret_t duk_bi_string_prototype_split(duk_hthread *thr) {
 		 *   b) empty input and no (zero size) match found (step 11)
 		 */
 
-		duk_push_lstring(thr,
-		                 (const char *) DUK_HSTRING_GET_DATA(h_input) + prev_match_end_boff,
-		                 (duk_size_t) (DUK_HSTRING_GET_BYTELEN(h_input) - prev_match_end_boff));
+		if (prev_match_end_boff == 0) {
+			/* Trailer is the whole input: avoid interning. */
+			duk_dup_2(thr);
+		} else {
+			duk_push_lstring(thr,
+			                 (const char *) DUK_HSTRING_GET_DATA(h_input) + prev_match_end_boff,
+			                 (duk_size_t) (DUK_HSTRING_GET_BYTELEN(h_input) - prev_match_end_boff));
+		}
 		duk_put_prop_index(thr, 3, arr_idx);
 		/* No arr_idx update or limit check */
 	}
@@ -108,7 +108,7 @@ DUK_LOCAL const char * const duk__bc_optab[256] = {
 
 	"NEWOBJ", "NEWARR", "MPUTOBJ", "MPUTOBJI", "INITSET", "INITGET", "MPUTARR", "MPUTARRI",
 	"SETALEN", "INITENUM", "NEXTENUM", "NEWTARGET", "DEBUGGER", "NOP", "INVALID", "UNUSED207",
-	"GETPROPC_RR", "GETPROPC_CR", "GETPROPC_RC", "GETPROPC_CC", "UNUSED212", "UNUSED213", "UNUSED214", "UNUSED215",
+	"GETPROPC_RR", "GETPROPC_CR", "GETPROPC_RC", "GETPROPC_CC", "ADDTMP_RR", "ADDTMP_CR", "ADDTMP_RC", "ADDTMP_CC",
 	"UNUSED216", "UNUSED217", "UNUSED218", "UNUSED219", "UNUSED220", "UNUSED221", "UNUSED222", "UNUSED223",
 
 	"UNUSED224", "UNUSED225", "UNUSED226", "UNUSED227", "UNUSED228", "UNUSED229", "UNUSED230", "UNUSED231",
@@ -537,6 +537,15 @@ DUK_LOCAL void duk__print_hobject(duk__dprint_state *st, duk_hobject *h) {
 		duk__print_hobject(st, p->target);
 		DUK__COMMA(); duk_fb_sprintf(fb, "__handler:");
 		duk__print_hobject(st, p->handler);
+#if defined(DUK_USE_MAP_BUILTIN)
+	} else if (st->internal && DUK_HOBJECT_IS_HMAP(h)) {
+		duk_hmap *m = (duk_hmap *) h;
+		DUK__COMMA(); duk_fb_sprintf(fb, "__entries:%p", (void *) m->entries);
+		DUK__COMMA(); duk_fb_sprintf(fb, "__gen:%p", (void *) m->gen);
+		DUK__COMMA(); duk_fb_sprintf(fb, "__e_size:%ld", (long) m->e_size);
+		DUK__COMMA(); duk_fb_sprintf(fb, "__e_next:%ld", (long) m->e_next);
+		DUK__COMMA(); duk_fb_sprintf(fb, "__count:%ld", (long) m->count);
+#endif
 	} else if (st->internal && DUK_HOBJECT_IS_THREAD(h)) {
 		duk_hthread *t = (duk_hthread *) h;
 		DUK__COMMA(); duk_fb_sprintf(fb, "__ptr_curr_pc:%p", (void *) t->ptr_curr_pc);
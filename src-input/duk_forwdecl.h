@@ -30,6 +30,7 @@ struct duk_hbufobj;
 struct duk_hdecenv;
 struct duk_hobjenv;
 struct duk_hproxy;
+struct duk_hmap;
 struct duk_hbuffer;
 struct duk_hbuffer_fixed;
 struct duk_hbuffer_dynamic;
@@ -91,6 +92,7 @@ typedef struct duk_hbufobj duk_hbufobj;
 typedef struct duk_hdecenv duk_hdecenv;
 typedef struct duk_hobjenv duk_hobjenv;
 typedef struct duk_hproxy duk_hproxy;
+typedef struct duk_hmap duk_hmap;
 typedef struct duk_hbuffer duk_hbuffer;
 typedef struct duk_hbuffer_fixed duk_hbuffer_fixed;
 typedef struct duk_hbuffer_dynamic duk_hbuffer_dynamic;
@@ -80,6 +80,11 @@
  */
 #define DUK_MS_FLAG_NO_OBJECT_COMPACTION     (1U << 2)
 
+/* Voluntary GC with incremental collection enabled: run a single bounded
+ * marking or sweeping step instead of a full mark-and-sweep.
+ */
+#define DUK_MS_FLAG_INCREMENTAL              (1U << 3)
+
 /*
  *  Thread switching
  *
@@ -132,6 +137,22 @@
 #define DUK_HEAP_MARK_AND_SWEEP_TRIGGER_SKIP              256L
 #endif
 
+/* With incremental mark-and-sweep, number of (re)allocation attempts
+ * between steps while a collection cycle is in progress.
+ */
+#define DUK_HEAP_MARK_AND_SWEEP_TRIGGER_STEP              256L
+
+/* Incremental mark-and-sweep phases (heap->ms_incremental).  Phases from
+ * DUK_HEAP_MS_INCR_FINALIZABLE onwards walk heap_allocated using
+ * heap->ms_sweep_curr.
+ */
+#define DUK_HEAP_MS_INCR_IDLE                             0  /* no cycle in progress */
+#define DUK_HEAP_MS_INCR_MARK                             1  /* marking, write barrier active */
+#define DUK_HEAP_MS_INCR_FINALIZABLE                      2  /* flagging unreachable objects with finalizers */
+#define DUK_HEAP_MS_INCR_MARK_FINALIZABLE                 3  /* marking finalizable objects */
+#define DUK_HEAP_MS_INCR_SWEEP_REFCOUNTS                  4  /* refcount finalizing unreachable objects */
+#define DUK_HEAP_MS_INCR_SWEEP                            5  /* freeing unreachable objects */
+
 /* GC torture. */
 #if defined(DUK_USE_GC_TORTURE)
 #define DUK_GC_TORTURE(heap) do { duk_heap_mark_and_sweep((heap), 0); } while (0)
@@ -145,6 +166,9 @@
 #define DUK_HEAP_STRCACHE_SIZE                            4
 #define DUK_HEAP_STRINGCACHE_NOCACHE_LIMIT                16  /* strings up to the this length are not cached */
 
+/* Maximum number of cached structs in each object freelist. */
+#define DUK_HEAP_HOBJECT_CACHE_LIMIT                      256
+
 /* Some list management macros. */
 #define DUK_HEAP_INSERT_INTO_HEAP_ALLOCATED(heap,hdr)     duk_heap_insert_into_heap_allocated((heap), (hdr))
 #if defined(DUK_USE_REFERENCE_COUNTING)
@@ -395,6 +419,16 @@ struct duk_heap {
 	duk_catcher *catcher_free;
 #endif
 
+	/* Freelists for plain object and array structs, linked through the
+	 * heap header next pointer and capped to DUK_HEAP_HOBJECT_CACHE_LIMIT.
+	 */
+#if defined(DUK_USE_CACHE_HOBJECT)
+	duk_hobject *hobject_free;
+	duk_hobject *harray_free;
+	duk_uint_t hobject_free_count;
+	duk_uint_t harray_free_count;
+#endif
+
 	/* Voluntary mark-and-sweep trigger counter.  Intentionally signed
 	 * because we continue decreasing the value when voluntary GC cannot
 	 * run.
@@ -429,6 +463,35 @@ struct duk_heap {
 	 */
 	duk_uint_t ms_prevent_count;
 
+#if defined(DUK_USE_INCREMENTAL_GC)
+	/* Incremental mark-and-sweep state, see DUK_HEAP_MS_INCR_xxx.
+	 *
+	 * While marking, the INCREF write barrier marks newly referenced
+	 * heap objects.  Objects marked but not yet scanned ("gray") live
+	 * on the gray stack, which holds a refcount on each entry so that
+	 * they can't be freed while queued.  The stack is allocated with
+	 * the raw allocation functions so that growing it can never
+	 * trigger a GC.
+	 *
+	 * After marking, ms_sweep_curr is the next heap_allocated entry
+	 * to process; everything before ms_sweep_start was allocated after
+	 * marking completed and is not swept.  Heap_allocated removals
+	 * keep these pointers valid.  ms_sweep_count counts finalizable
+	 * objects and then objects kept by the sweep.
+	 */
+	duk_small_uint_t ms_incremental;
+	duk_small_uint_t ms_sweep_flags;
+	duk_heaphdr **ms_gray;
+	duk_size_t ms_gray_top;
+	duk_size_t ms_gray_size;
+	duk_heaphdr *ms_sweep_start;
+	duk_heaphdr *ms_sweep_curr;
+	duk_size_t ms_sweep_count;
+
+	/* All threads, for scanning value stacks when a cycle begins. */
+	duk_hthread *ms_threads;
+#endif
+
 	/* Finalizer processing prevent count, stacking.  Bumped when finalizers
 	 * are processed to prevent recursive finalizer processing (first call site
 	 * processing finalizers handles all finalizers until the list is empty).
@@ -629,11 +692,13 @@ struct duk_heap {
 	duk_int_t stats_getprop_stringlen;
 	duk_int_t stats_getprop_proxy;
 	duk_int_t stats_getprop_arguments;
+	duk_int_t stats_getprop_entry;
 	duk_int_t stats_putprop_all;
 	duk_int_t stats_putprop_arrayidx;
 	duk_int_t stats_putprop_bufobjidx;
 	duk_int_t stats_putprop_bufferidx;
 	duk_int_t stats_putprop_proxy;
+	duk_int_t stats_putprop_entry;
 	duk_int_t stats_getvar_all;
 	duk_int_t stats_putvar_all;
 	duk_int_t stats_envrec_delayedcreate;
@@ -681,6 +746,9 @@ DUK_INTERNAL_DECL duk_hstring *duk_heap_strtable_intern_checked(duk_hthread *thr
 DUK_INTERNAL_DECL duk_hstring *duk_heap_strtable_intern_literal_checked(duk_hthread *thr, const duk_uint8_t *str, duk_uint32_t blen);
 #endif
 DUK_INTERNAL_DECL duk_hstring *duk_heap_strtable_intern_u32(duk_heap *heap, duk_uint32_t val);
+#if defined(DUK_USE_HSTRING_APPEND)
+DUK_INTERNAL_DECL duk_hstring *duk_heap_strtable_append(duk_heap *heap, duk_hstring *h1, duk_hstring *h2);
+#endif
 DUK_INTERNAL_DECL duk_hstring *duk_heap_strtable_intern_u32_checked(duk_hthread *thr, duk_uint32_t val);
 #if defined(DUK_USE_REFERENCE_COUNTING)
 DUK_INTERNAL_DECL void duk_heap_strtable_unlink(duk_heap *heap, duk_hstring *h);
@@ -717,6 +785,12 @@ DUK_INTERNAL_DECL void duk_heap_process_finalize_list(duk_heap *heap);
 #endif  /* DUK_USE_FINALIZER_SUPPORT */
 
 DUK_INTERNAL_DECL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags);
+#if defined(DUK_USE_INCREMENTAL_GC)
+DUK_INTERNAL_DECL void duk_heap_mark_barrier(duk_heap *heap, duk_heaphdr *h);
+DUK_INTERNAL_DECL void duk_heap_free_gray_stack(duk_heap *heap);
+DUK_INTERNAL_DECL void duk_heap_insert_into_threads(duk_heap *heap, duk_hthread *thr);
+DUK_INTERNAL_DECL void duk_heap_remove_from_threads(duk_heap *heap, duk_hthread *thr);
+#endif
 
 DUK_INTERNAL_DECL duk_uint32_t duk_heap_hashstring(duk_heap *heap, const duk_uint8_t *str, duk_size_t len);
 
@@ -36,6 +36,9 @@ DUK_INTERNAL void duk_free_hobject(duk_heap *heap, duk_hobject *h) {
 		duk_hthread *t = (duk_hthread *) h;
 		duk_activation *act;
 
+#if defined(DUK_USE_INCREMENTAL_GC)
+		duk_heap_remove_from_threads(heap, t);
+#endif
 		DUK_FREE(heap, t->valstack);
 
 		/* Don't free h->resumer because it exists in the heap.
@@ -69,7 +72,36 @@ DUK_INTERNAL void duk_free_hobject(duk_heap *heap, duk_hobject *h) {
 		duk_hboundfunc *f = (duk_hboundfunc *) (void *) h;
 
 		DUK_FREE(heap, f->args);
+#if defined(DUK_USE_MAP_BUILTIN)
+	} else if (DUK_HOBJECT_IS_HMAP(h)) {
+		duk_hmap *m = (duk_hmap *) h;
+
+		DUK_FREE(heap, m->entries);
+#endif
+	}
+
+#if defined(DUK_USE_CACHE_HOBJECT)
+	/* Plain objects and arrays are the only FASTREFS objects besides
+	 * native functions, so their struct size is known here.
+	 */
+	if (DUK_HOBJECT_HAS_FASTREFS(h) && !DUK_HOBJECT_IS_NATFUNC(h)) {
+		if (DUK_HOBJECT_IS_ARRAY(h)) {
+			if (heap->harray_free_count < DUK_HEAP_HOBJECT_CACHE_LIMIT) {
+				DUK_HEAPHDR_SET_NEXT(heap, &h->hdr, (duk_heaphdr *) heap->harray_free);
+				heap->harray_free = h;
+				heap->harray_free_count++;
+				return;
+			}
+		} else {
+			if (heap->hobject_free_count < DUK_HEAP_HOBJECT_CACHE_LIMIT) {
+				DUK_HEAPHDR_SET_NEXT(heap, &h->hdr, (duk_heaphdr *) heap->hobject_free);
+				heap->hobject_free = h;
+				heap->hobject_free_count++;
+				return;
+			}
+		}
 	}
+#endif
 
 	DUK_FREE(heap, (void *) h);
 }
@@ -175,22 +207,48 @@ DUK_LOCAL duk_size_t duk__heap_free_catcher_freelist(duk_heap *heap) {
 }
 #endif  /* DUK_USE_CACHE_CATCHER */
 
+#if defined(DUK_USE_CACHE_HOBJECT)
+DUK_LOCAL duk_size_t duk__heap_free_hobject_freelist(duk_heap *heap, duk_hobject *h) {
+	duk_hobject *h_next;
+	duk_size_t count_obj = 0;
+
+	while (h != NULL) {
+		h_next = (duk_hobject *) DUK_HEAPHDR_GET_NEXT(heap, &h->hdr);
+		DUK_FREE(heap, (void *) h);
+		h = h_next;
+		count_obj++;
+	}
+	return count_obj;
+}
+#endif  /* DUK_USE_CACHE_HOBJECT */
+
 DUK_INTERNAL void duk_heap_free_freelists(duk_heap *heap) {
 	duk_size_t count_act = 0;
 	duk_size_t count_cat = 0;
+	duk_size_t count_obj = 0;
 
 #if defined(DUK_USE_CACHE_ACTIVATION)
 	count_act = duk__heap_free_activation_freelist(heap);
 #endif
 #if defined(DUK_USE_CACHE_CATCHER)
 	count_cat = duk__heap_free_catcher_freelist(heap);
+#endif
+#if defined(DUK_USE_CACHE_HOBJECT)
+	count_obj = duk__heap_free_hobject_freelist(heap, heap->hobject_free);
+	count_obj += duk__heap_free_hobject_freelist(heap, heap->harray_free);
+	DUK_ASSERT(count_obj == (duk_size_t) heap->hobject_free_count + (duk_size_t) heap->harray_free_count);
+	heap->hobject_free = NULL;  /* needed when called from mark-and-sweep */
+	heap->harray_free = NULL;
+	heap->hobject_free_count = 0;
+	heap->harray_free_count = 0;
 #endif
 	DUK_UNREF(heap);
 	DUK_UNREF(count_act);
 	DUK_UNREF(count_cat);
+	DUK_UNREF(count_obj);
 
-	DUK_D(DUK_DPRINT("freed %ld activation freelist entries, %ld catcher freelist entries",
-	                 (long) count_act, (long) count_cat));
+	DUK_D(DUK_DPRINT("freed %ld activation freelist entries, %ld catcher freelist entries, %ld object freelist entries",
+	                 (long) count_act, (long) count_cat, (long) count_obj));
 }
 
 DUK_LOCAL void duk__free_allocated(duk_heap *heap) {
@@ -402,8 +460,9 @@ DUK_INTERNAL void duk_heap_free(duk_heap *heap) {
 	 * are on the heap allocated list.
 	 */
 
-	DUK_D(DUK_DPRINT("freeing temporary freelists"));
-	duk_heap_free_freelists(heap);
+#if defined(DUK_USE_INCREMENTAL_GC)
+	duk_heap_free_gray_stack(heap);
+#endif
 
 	DUK_D(DUK_DPRINT("freeing heap_allocated of heap: %p", (void *) heap));
 	duk__free_allocated(heap);
@@ -417,6 +476,12 @@ DUK_INTERNAL void duk_heap_free(duk_heap *heap) {
 	duk__free_finalize_list(heap);
 #endif
 
+	/* Freed after heap objects, which may be placed in the object
+	 * freelists when freed.
+	 */
+	DUK_D(DUK_DPRINT("freeing temporary freelists"));
+	duk_heap_free_freelists(heap);
+
 	DUK_D(DUK_DPRINT("freeing string table of heap: %p", (void *) heap));
 	duk__free_stringtable(heap);
 
@@ -507,10 +572,13 @@ DUK_LOCAL duk_bool_t duk__init_heap_strings(duk_heap *heap) {
 
 		DUK_DDD(DUK_DDDPRINT("interned: %!O", (duk_heaphdr *) h));
 
-		/* XXX: The incref macro takes a thread pointer but doesn't
-		 * use it right now.
+		/* No thread exists yet for the incref macro, but no
+		 * incremental mark-and-sweep cycle can be in progress
+		 * either, so a plain refcount bump is enough.
 		 */
-		DUK_HSTRING_INCREF(_never_referenced_, h);
+#if defined(DUK_USE_REFERENCE_COUNTING)
+		DUK_HEAPHDR_PREINC_REFCOUNT((duk_heaphdr *) h);
+#endif
 
 #if defined(DUK_USE_HEAPPTR16)
 		heap->strs16[i] = DUK_USE_HEAPPTR_ENC16(heap->heap_udata, (void *) h);
@@ -679,6 +747,9 @@ DUK_LOCAL void duk__dump_type_sizes(void) {
 	DUK__DUMPSZ(duk_hbufobj);
 #endif
 	DUK__DUMPSZ(duk_hproxy);
+#if defined(DUK_USE_MAP_BUILTIN)
+	DUK__DUMPSZ(duk_hmap);
+#endif
 	DUK__DUMPSZ(duk_hbuffer);
 	DUK__DUMPSZ(duk_hbuffer_fixed);
 	DUK__DUMPSZ(duk_hbuffer_dynamic);
@@ -922,10 +993,19 @@ duk_heap *duk_heap_alloc(duk_alloc_function alloc_func,
 #endif
 #if defined(DUK_USE_CACHE_CATCHER)
 	res->catcher_free = NULL;
+#endif
+#if defined(DUK_USE_CACHE_HOBJECT)
+	res->hobject_free = NULL;
+	res->harray_free = NULL;
+	res->hobject_free_count = 0;
+	res->harray_free_count = 0;
 #endif
 	res->heap_thread = NULL;
 	res->curr_thread = NULL;
 	res->heap_object = NULL;
+#if defined(DUK_USE_INCREMENTAL_GC)
+	res->ms_gray = NULL;
+#endif
 #if defined(DUK_USE_STRTAB_PTRCOMP)
 	res->strtable16 = NULL;
 #else
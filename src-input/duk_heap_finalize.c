@@ -176,8 +176,20 @@ DUK_INTERNAL void duk_heap_process_finalize_list(duk_heap *heap) {
 		DUK_DD(DUK_DDPRINT("processing finalize_list entry: %p -> %!iO", (void *) curr, curr));
 
 		DUK_ASSERT(DUK_HEAPHDR_GET_TYPE(curr) == DUK_HTYPE_OBJECT);  /* Only objects have finalizers. */
+#if defined(DUK_USE_INCREMENTAL_GC)
+		/* Finalize_list objects may get marked while an incremental
+		 * cycle is marking.
+		 */
+		DUK_ASSERT(heap->ms_incremental == DUK_HEAP_MS_INCR_MARK ||
+		           heap->ms_incremental == DUK_HEAP_MS_INCR_MARK_FINALIZABLE ||
+		           !DUK_HEAPHDR_HAS_REACHABLE(curr));
+		DUK_ASSERT(heap->ms_incremental == DUK_HEAP_MS_INCR_MARK ||
+		           heap->ms_incremental == DUK_HEAP_MS_INCR_MARK_FINALIZABLE ||
+		           !DUK_HEAPHDR_HAS_TEMPROOT(curr));
+#else
 		DUK_ASSERT(!DUK_HEAPHDR_HAS_REACHABLE(curr));
 		DUK_ASSERT(!DUK_HEAPHDR_HAS_TEMPROOT(curr));
+#endif
 		DUK_ASSERT(DUK_HEAPHDR_HAS_FINALIZABLE(curr));  /* All objects on finalize_list will have this flag (except object being finalized right now). */
 		DUK_ASSERT(!DUK_HEAPHDR_HAS_FINALIZED(curr));   /* Queueing code ensures. */
 		DUK_ASSERT(!DUK_HEAPHDR_HAS_READONLY(curr));  /* ROM objects never get freed (or finalized). */
@@ -277,6 +289,14 @@ DUK_INTERNAL void duk_heap_process_finalize_list(duk_heap *heap) {
 			DUK_ASSERT(DUK_HEAPHDR_GET_REFCOUNT(curr) >= 1);
 			DUK_HEAPHDR_PREDEC_REFCOUNT(curr);  /* Remove artificial refcount bump. */
 			DUK_HEAPHDR_CLEAR_FINALIZABLE(curr);
+#if defined(DUK_USE_INCREMENTAL_GC)
+			/* Once marking is done, an incremental cycle doesn't
+			 * sweep objects queued back, so clear a stale mark.
+			 */
+			if (heap->ms_incremental >= DUK_HEAP_MS_INCR_FINALIZABLE) {
+				DUK_HEAPHDR_CLEAR_REACHABLE(curr);
+			}
+#endif
 			DUK_HEAP_INSERT_INTO_HEAP_ALLOCATED(heap, curr);
 		} else {
 			/* No need to remove the refcount bump here. */
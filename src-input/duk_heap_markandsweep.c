@@ -8,6 +8,9 @@ DUK_LOCAL_DECL void duk__mark_heaphdr(duk_heap *heap, duk_heaphdr *h);
 DUK_LOCAL_DECL void duk__mark_heaphdr_nonnull(duk_heap *heap, duk_heaphdr *h);
 DUK_LOCAL_DECL void duk__mark_tval(duk_heap *heap, duk_tval *tv);
 DUK_LOCAL_DECL void duk__mark_tvals(duk_heap *heap, duk_tval *tv, duk_idx_t count);
+#if defined(DUK_USE_INCREMENTAL_GC)
+DUK_LOCAL_DECL void duk__gray_push(duk_heap *heap, duk_heaphdr *h);
+#endif
 
 /*
  *  Marking functions for heap types: mark children recursively.
@@ -128,6 +131,13 @@ DUK_LOCAL void duk__mark_hobject(duk_heap *heap, duk_hobject *h) {
 		duk__mark_heaphdr_nonnull(heap, (duk_heaphdr *) p->target);
 		duk__mark_heaphdr_nonnull(heap, (duk_heaphdr *) p->handler);
 #endif  /* DUK_USE_ES6_PROXY */
+#if defined(DUK_USE_MAP_BUILTIN)
+	} else if (DUK_HOBJECT_IS_HMAP(h)) {
+		duk_hmap *m = (duk_hmap *) h;
+		DUK_HMAP_ASSERT_VALID(m);
+		duk__mark_tvals(heap, m->entries, (duk_idx_t) (m->e_next * DUK_HMAP_GET_STRIDE(m)));
+		duk__mark_heaphdr(heap, (duk_heaphdr *) m->gen);
+#endif  /* DUK_USE_MAP_BUILTIN */
 	} else if (DUK_HOBJECT_IS_THREAD(h)) {
 		duk_hthread *t = (duk_hthread *) h;
 		duk_activation *act;
@@ -201,6 +211,19 @@ DUK_LOCAL void duk__mark_heaphdr(duk_heap *heap, duk_heaphdr *h) {
 
 	DUK_HEAPHDR_SET_REACHABLE(h);
 
+#if defined(DUK_USE_INCREMENTAL_GC)
+	if (heap->ms_incremental == DUK_HEAP_MS_INCR_MARK) {
+		/* Incremental marking: don't recurse, queue objects on the
+		 * gray stack to be scanned by a later step.  Strings and
+		 * buffers have no children and are done once marked.
+		 */
+		if (DUK_HEAPHDR_IS_OBJECT(h)) {
+			duk__gray_push(heap, h);
+		}
+		return;
+	}
+#endif
+
 	if (heap->ms_recursion_depth >= DUK_USE_MARK_AND_SWEEP_RECLIMIT) {
 		DUK_D(DUK_DPRINT("mark-and-sweep recursion limit reached, marking as temproot: %p", (void *) h));
 		DUK_HEAP_SET_MARKANDSWEEP_RECLIMIT_REACHED(heap);
@@ -484,6 +507,246 @@ DUK_LOCAL void duk__mark_temproots_by_heap_scan(duk_heap *heap) {
 	}
 }
 
+/*
+ *  Incremental marking.
+ *
+ *  A cycle begins by marking the roots.  Marked objects are pushed to the
+ *  gray stack and each step scans gray objects until the work budget runs
+ *  out.  Meanwhile the INCREF write barrier marks any heap object that gets
+ *  a new reference, so that a scanned object can never end up pointing to
+ *  an unmarked one.  Objects allocated while marking are born marked.
+ *
+ *  Value stacks are modified without refcount updates in a few places
+ *  (e.g. values moved between threads), so marking is finished by scanning
+ *  the value stacks of all reachable threads again.  After that the normal
+ *  mark-and-sweep code completes the cycle; it sees the incremental marks
+ *  as already reachable.  Objects which became garbage during the cycle
+ *  are floating garbage and are collected by the next cycle (or by
+ *  refcounting).
+ */
+
+#if defined(DUK_USE_INCREMENTAL_GC)
+DUK_LOCAL void duk__gray_push(duk_heap *heap, duk_heaphdr *h) {
+	DUK_ASSERT(heap->ms_incremental == DUK_HEAP_MS_INCR_MARK);
+	DUK_ASSERT(DUK_HEAPHDR_IS_OBJECT(h));
+	DUK_ASSERT(DUK_HEAPHDR_HAS_REACHABLE(h));
+	DUK_ASSERT(!DUK_HEAPHDR_HAS_READONLY(h));
+
+	if (DUK_UNLIKELY(heap->ms_gray_top >= heap->ms_gray_size)) {
+		duk_size_t new_size;
+		duk_heaphdr **new_gray;
+
+		/* Use the raw allocation functions: a GC here would recurse
+		 * into mark-and-sweep.
+		 */
+		new_size = heap->ms_gray_size * 2 + 64;
+		new_gray = NULL;
+		if (new_size > heap->ms_gray_size &&
+		    new_size <= DUK_SIZE_MAX / sizeof(duk_heaphdr *)) {
+			new_gray = (duk_heaphdr **) heap->realloc_func(heap->heap_udata,
+			                                                (void *) heap->ms_gray,
+			                                                new_size * sizeof(duk_heaphdr *));
+		}
+		if (new_gray == NULL) {
+			/* Fall back to a temproot heap scan when the cycle
+			 * is finished, same as for the recursion limit.
+			 */
+			DUK_D(DUK_DPRINT("failed to grow gray stack, marking as temproot: %p", (void *) h));
+			DUK_HEAP_SET_MARKANDSWEEP_RECLIMIT_REACHED(heap);
+			DUK_HEAPHDR_SET_TEMPROOT(h);
+			return;
+		}
+		heap->ms_gray = new_gray;
+		heap->ms_gray_size = new_size;
+	}
+
+	DUK_HEAPHDR_PREINC_REFCOUNT(h);  /* Keep alive while on the gray stack. */
+	heap->ms_gray[heap->ms_gray_top++] = h;
+}
+
+/* Scan gray objects until the stack is empty or the budget is exhausted.
+ * Returns 1 if the stack was emptied.
+ */
+DUK_LOCAL duk_bool_t duk__gray_drain(duk_heap *heap, duk_int_t budget) {
+	while (heap->ms_gray_top > 0) {
+		duk_hobject *h;
+
+		if (budget <= 0) {
+			return 0;
+		}
+
+		h = (duk_hobject *) heap->ms_gray[--heap->ms_gray_top];
+		DUK_ASSERT(h != NULL);
+		DUK_ASSERT(DUK_HEAPHDR_HAS_REACHABLE((duk_heaphdr *) h));
+		DUK_ASSERT(DUK_HEAPHDR_GET_REFCOUNT((duk_heaphdr *) h) > 0);
+
+		/* Refzero is not processed while mark-and-sweep is running,
+		 * so an object whose only reference was the gray stack stays
+		 * in heap_allocated and is collected by the next cycle.  Its
+		 * children must still be marked because it stays reachable
+		 * for this cycle.
+		 */
+		DUK_HEAPHDR_PREDEC_REFCOUNT((duk_heaphdr *) h);
+
+		duk__mark_hobject(heap, h);
+		budget -= (duk_int_t) (1 + DUK_HOBJECT_GET_ENEXT(h) + DUK_HOBJECT_GET_ASIZE(h));
+	}
+	return 1;
+}
+
+/* Run one marking step, beginning a new cycle if necessary.  Returns 1 if
+ * the gray stack is empty and the cycle can be finished.
+ */
+DUK_LOCAL duk_bool_t duk__mark_incremental_step(duk_heap *heap) {
+	duk_bool_t done;
+
+	DUK_ASSERT(heap->ms_prevent_count == 0);
+	DUK_ASSERT(heap->ms_running == 0);
+	heap->ms_prevent_count = 1;
+	heap->ms_running = 1;
+
+	if (heap->ms_incremental == DUK_HEAP_MS_INCR_IDLE) {
+		DUK_DD(DUK_DDPRINT("incremental mark-and-sweep cycle begins"));
+		DUK_ASSERT(heap->ms_gray_top == 0);
+		heap->ms_incremental = DUK_HEAP_MS_INCR_MARK;
+		duk__mark_roots_heap(heap);
+	}
+	DUK_ASSERT(heap->ms_incremental == DUK_HEAP_MS_INCR_MARK);
+	done = duk__gray_drain(heap, DUK_USE_INCREMENTAL_GC_BUDGET);
+
+	DUK_ASSERT(heap->ms_prevent_count == 1);
+	DUK_ASSERT(heap->ms_running == 1);
+	heap->ms_prevent_count = 0;
+	heap->ms_running = 0;
+
+	DUK_DD(DUK_DDPRINT("incremental mark step, gray stack %ld, done %ld",
+	                   (long) heap->ms_gray_top, (long) done));
+	return done;
+}
+
+/* Finish marking for a cycle in progress; the rest of the cycle is run by
+ * the normal mark-and-sweep code.
+ */
+DUK_LOCAL void duk__mark_incremental_finish(duk_heap *heap) {
+	duk_hthread *thr;
+
+	DUK_ASSERT(heap->ms_incremental == DUK_HEAP_MS_INCR_MARK);
+	DUK_ASSERT(heap->ms_running == 1);
+
+	(void) duk__gray_drain(heap, DUK_INT_MAX);
+	DUK_ASSERT(heap->ms_gray_top == 0);
+	heap->ms_incremental = DUK_HEAP_MS_INCR_IDLE;
+	duk_heap_free_gray_stack(heap);
+
+	/* Rescan reachable threads, marking recursively from here on. */
+	for (thr = heap->ms_threads; thr != NULL; thr = thr->ms_thr_next) {
+		if (DUK_HEAPHDR_HAS_REACHABLE((duk_heaphdr *) thr)) {
+			duk__mark_hobject(heap, (duk_hobject *) thr);
+		}
+	}
+}
+
+/* Abandon marking for a cycle in progress, so that a full mark-and-sweep
+ * requested meanwhile (emergency GC, duk_gc()) starts from scratch and
+ * also collects garbage created while marking.
+ */
+DUK_LOCAL void duk__mark_incremental_abort(duk_heap *heap) {
+	duk_heaphdr *hdr;
+	duk_hstring *h;
+	duk_uint32_t i;
+
+	DUK_DD(DUK_DDPRINT("abort incremental marking, gray stack %ld", (long) heap->ms_gray_top));
+
+	DUK_ASSERT(heap->ms_incremental == DUK_HEAP_MS_INCR_MARK);
+	DUK_ASSERT(heap->ms_running == 0);
+
+	/* Objects whose only reference was the gray stack are left with
+	 * a zero refcount and are collected by the mark-and-sweep.
+	 */
+	while (heap->ms_gray_top > 0) {
+		hdr = heap->ms_gray[--heap->ms_gray_top];
+		DUK_HEAPHDR_PREDEC_REFCOUNT(hdr);
+	}
+	heap->ms_incremental = DUK_HEAP_MS_INCR_IDLE;
+	duk_heap_free_gray_stack(heap);
+	DUK_HEAP_CLEAR_MARKANDSWEEP_RECLIMIT_REACHED(heap);
+
+	for (hdr = heap->heap_allocated; hdr != NULL; hdr = DUK_HEAPHDR_GET_NEXT(heap, hdr)) {
+		DUK_HEAPHDR_CLEAR_REACHABLE(hdr);
+		DUK_HEAPHDR_CLEAR_TEMPROOT(hdr);
+	}
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+	for (hdr = heap->finalize_list; hdr != NULL; hdr = DUK_HEAPHDR_GET_NEXT(heap, hdr)) {
+		DUK_HEAPHDR_CLEAR_REACHABLE(hdr);
+		DUK_HEAPHDR_CLEAR_TEMPROOT(hdr);
+	}
+#endif
+#if defined(DUK_USE_STRTAB_PTRCOMP)
+	if (heap->strtable16 != NULL) {
+#else
+	if (heap->strtable != NULL) {
+#endif
+		for (i = 0; i < heap->st_size; i++) {
+#if defined(DUK_USE_STRTAB_PTRCOMP)
+			h = DUK_USE_HEAPPTR_DEC16(heap->heap_udata, heap->strtable16[i]);
+#else
+			h = heap->strtable[i];
+#endif
+			for (; h != NULL; h = h->hdr.h_next) {
+				DUK_HEAPHDR_CLEAR_REACHABLE((duk_heaphdr *) h);
+			}
+		}
+	}
+}
+
+/* Write barrier, called by INCREF while marking. */
+DUK_INTERNAL void duk_heap_mark_barrier(duk_heap *heap, duk_heaphdr *h) {
+	DUK_ASSERT(heap != NULL);
+	DUK_ASSERT(h != NULL);
+
+	if (heap->ms_incremental != DUK_HEAP_MS_INCR_MARK || DUK_HEAPHDR_HAS_REACHABLE(h)) {
+		return;
+	}
+	duk__mark_heaphdr_nonnull(heap, h);
+}
+
+DUK_INTERNAL void duk_heap_free_gray_stack(duk_heap *heap) {
+	DUK_ASSERT(heap != NULL);
+
+	heap->free_func(heap->heap_udata, (void *) heap->ms_gray);
+	heap->ms_gray = NULL;
+	heap->ms_gray_top = 0;
+	heap->ms_gray_size = 0;
+}
+
+DUK_INTERNAL void duk_heap_insert_into_threads(duk_heap *heap, duk_hthread *thr) {
+	DUK_ASSERT(heap != NULL);
+	DUK_ASSERT(thr != NULL);
+
+	thr->ms_thr_prev = NULL;
+	thr->ms_thr_next = heap->ms_threads;
+	if (heap->ms_threads != NULL) {
+		heap->ms_threads->ms_thr_prev = thr;
+	}
+	heap->ms_threads = thr;
+}
+
+DUK_INTERNAL void duk_heap_remove_from_threads(duk_heap *heap, duk_hthread *thr) {
+	DUK_ASSERT(heap != NULL);
+	DUK_ASSERT(thr != NULL);
+
+	if (thr->ms_thr_prev != NULL) {
+		thr->ms_thr_prev->ms_thr_next = thr->ms_thr_next;
+	} else {
+		DUK_ASSERT(heap->ms_threads == thr);
+		heap->ms_threads = thr->ms_thr_next;
+	}
+	if (thr->ms_thr_next != NULL) {
+		thr->ms_thr_next->ms_thr_prev = thr->ms_thr_prev;
+	}
+}
+#endif  /* DUK_USE_INCREMENTAL_GC */
+
 /*
  *  Finalize refcounts for heap elements just about to be freed.
  *  This must be done for all objects before freeing to avoid any
@@ -825,6 +1088,218 @@ DUK_LOCAL void duk__sweep_heap(duk_heap *heap, duk_small_uint_t flags, duk_size_
 	*out_count_keep = count_keep;
 }
 
+/*
+ *  Incremental sweep.
+ *
+ *  When a voluntary step completes marking, the rest of the cycle walks
+ *  heap_allocated in slices run by the following steps: unreachable objects
+ *  with finalizers are flagged and then marked (like duk__mark_finalizable()),
+ *  refcounts of unreachable objects are finalized, and finally the objects
+ *  are swept.  This is safe because an unreachable object can never become
+ *  reachable again.  Objects allocated in the meantime are inserted before
+ *  ms_sweep_start and are not swept, and objects removed from heap_allocated
+ *  (e.g. by refzero) update the sweep pointers, see
+ *  duk_heap_remove_from_heap_allocated().  The string table is swept at the
+ *  end; strings interned meanwhile are marked so that they're kept.
+ */
+
+#if defined(DUK_USE_INCREMENTAL_GC)
+DUK_LOCAL void duk__sweep_incremental_begin(duk_heap *heap, duk_small_uint_t flags) {
+	DUK_ASSERT(heap->ms_incremental == DUK_HEAP_MS_INCR_IDLE);
+
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+	heap->ms_incremental = DUK_HEAP_MS_INCR_FINALIZABLE;
+#else
+	heap->ms_incremental = DUK_HEAP_MS_INCR_SWEEP_REFCOUNTS;
+#endif
+	heap->ms_sweep_flags = flags;
+	heap->ms_sweep_start = heap->heap_allocated;
+	heap->ms_sweep_curr = heap->heap_allocated;
+	heap->ms_sweep_count = 0;
+}
+
+/* Unlink an object which has already been passed by the sweep cursor. */
+DUK_LOCAL void duk__sweep_incremental_unlink(duk_heap *heap, duk_heaphdr *curr) {
+	duk_heaphdr *prev;
+	duk_heaphdr *next;
+
+	DUK_ASSERT(heap->ms_sweep_curr != curr);
+
+	prev = DUK_HEAPHDR_GET_PREV(heap, curr);
+	next = DUK_HEAPHDR_GET_NEXT(heap, curr);
+	if (prev != NULL) {
+		DUK_HEAPHDR_SET_NEXT(heap, prev, next);
+	} else {
+		DUK_ASSERT(heap->heap_allocated == curr);
+		heap->heap_allocated = next;
+	}
+	if (next != NULL) {
+		DUK_HEAPHDR_SET_PREV(heap, next, prev);
+	}
+	if (heap->ms_sweep_start == curr) {
+		heap->ms_sweep_start = next;
+	}
+}
+
+/* Sweep a single object, same decisions as duk__sweep_heap(). */
+DUK_LOCAL void duk__sweep_incremental_object(duk_heap *heap, duk_heaphdr *curr) {
+	DUK_ASSERT(DUK_HEAPHDR_GET_TYPE(curr) != DUK_HTYPE_STRING);
+	DUK_ASSERT(!DUK_HEAPHDR_HAS_READONLY(curr));
+
+	if (DUK_HEAPHDR_HAS_REACHABLE(curr)) {
+		DUK_HEAPHDR_CLEAR_REACHABLE(curr);
+
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+		if (DUK_UNLIKELY(DUK_HEAPHDR_HAS_FINALIZABLE(curr))) {
+			DUK_ASSERT(!DUK_HEAPHDR_HAS_FINALIZED(curr));
+			DUK_ASSERT(DUK_HEAPHDR_GET_TYPE(curr) == DUK_HTYPE_OBJECT);
+			DUK_DD(DUK_DDPRINT("incremental sweep; reachable, finalizable --> move to finalize_list: %p", (void *) curr));
+
+			duk__sweep_incremental_unlink(heap, curr);
+			DUK_HEAPHDR_PREINC_REFCOUNT(curr);  /* Bump refcount so that refzero never occurs when pending a finalizer call. */
+			DUK_HEAP_INSERT_INTO_FINALIZE_LIST(heap, curr);
+			return;
+		}
+#endif
+
+		if (DUK_UNLIKELY(DUK_HEAPHDR_HAS_FINALIZED(curr))) {
+			DUK_ASSERT(DUK_HEAPHDR_GET_TYPE(curr) == DUK_HTYPE_OBJECT);
+			if (heap->ms_sweep_flags & DUK_MS_FLAG_POSTPONE_RESCUE) {
+				heap->ms_sweep_count++;
+			} else {
+				DUK_DD(DUK_DDPRINT("incremental sweep; reachable, finalized --> rescued after finalization: %p", (void *) curr));
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+				DUK_HEAPHDR_CLEAR_FINALIZED(curr);
+#endif
+			}
+		} else {
+			heap->ms_sweep_count++;
+		}
+
+		if (DUK_HEAPHDR_IS_OBJECT(curr) && DUK_HOBJECT_IS_THREAD((duk_hobject *) curr)) {
+			duk_valstack_shrink_check_nothrow((duk_hthread *) curr, 0 /*snug*/);
+		}
+	} else {
+		/* Refcount finalization of all unreachable objects has
+		 * cancelled out their refcounts, see duk__sweep_heap().
+		 */
+		DUK_ASSERT(DUK_HEAPHDR_GET_REFCOUNT(curr) == 0);
+		DUK_ASSERT(!DUK_HEAPHDR_HAS_FINALIZABLE(curr));
+		DUK_DD(DUK_DDPRINT("incremental sweep; not reachable --> free: %p", (void *) curr));
+
+		duk__sweep_incremental_unlink(heap, curr);
+		duk_heap_free_heaphdr_raw(heap, curr);
+	}
+}
+
+/* Run a bounded sweep step; DUK_INT_MAX finishes the sweep.  Returns 1 if
+ * the cycle is complete.
+ */
+DUK_LOCAL duk_bool_t duk__sweep_incremental_step(duk_heap *heap, duk_int_t budget) {
+	duk_heaphdr *curr;
+	duk_size_t count_keep_str;
+	duk_size_t tmp;
+
+	DUK_ASSERT(heap->ms_prevent_count == 0);
+	DUK_ASSERT(heap->ms_running == 0);
+	heap->ms_prevent_count = 1;
+	heap->ms_running = 1;
+
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+	if (heap->ms_incremental == DUK_HEAP_MS_INCR_FINALIZABLE) {
+		while ((curr = heap->ms_sweep_curr) != NULL) {
+			if (budget <= 0) {
+				goto yield;
+			}
+			budget--;
+			heap->ms_sweep_curr = DUK_HEAPHDR_GET_NEXT(heap, curr);
+			if (!DUK_HEAPHDR_HAS_REACHABLE(curr) &&
+			    DUK_HEAPHDR_IS_OBJECT(curr) &&
+			    !DUK_HEAPHDR_HAS_FINALIZED(curr) &&
+			    DUK_HOBJECT_HAS_FINALIZER_FAST(heap, (duk_hobject *) curr)) {
+				DUK_ASSERT(!DUK_HEAPHDR_HAS_READONLY(curr));
+				DUK_HEAPHDR_SET_FINALIZABLE(curr);
+				heap->ms_sweep_count++;
+			}
+		}
+		heap->ms_incremental = (heap->ms_sweep_count > 0 ?
+		                        DUK_HEAP_MS_INCR_MARK_FINALIZABLE : DUK_HEAP_MS_INCR_SWEEP_REFCOUNTS);
+		heap->ms_sweep_curr = heap->ms_sweep_start;
+		heap->ms_sweep_count = 0;
+	}
+
+	if (heap->ms_incremental == DUK_HEAP_MS_INCR_MARK_FINALIZABLE) {
+		while ((curr = heap->ms_sweep_curr) != NULL) {
+			if (budget <= 0) {
+				goto yield;
+			}
+			budget--;
+			heap->ms_sweep_curr = DUK_HEAPHDR_GET_NEXT(heap, curr);
+			if (DUK_HEAPHDR_HAS_FINALIZABLE(curr)) {
+				duk__mark_heaphdr_nonnull(heap, curr);
+			}
+		}
+		duk__mark_temproots_by_heap_scan(heap);
+		duk__clear_finalize_list_flags(heap);
+		heap->ms_incremental = DUK_HEAP_MS_INCR_SWEEP_REFCOUNTS;
+		heap->ms_sweep_curr = heap->ms_sweep_start;
+	}
+#endif  /* DUK_USE_FINALIZER_SUPPORT */
+
+	if (heap->ms_incremental == DUK_HEAP_MS_INCR_SWEEP_REFCOUNTS) {
+		while ((curr = heap->ms_sweep_curr) != NULL) {
+			if (budget <= 0) {
+				goto yield;
+			}
+			budget--;
+			heap->ms_sweep_curr = DUK_HEAPHDR_GET_NEXT(heap, curr);
+			if (!DUK_HEAPHDR_HAS_REACHABLE(curr)) {
+				duk_heaphdr_refcount_finalize_norz(heap, curr);
+			}
+		}
+		heap->ms_incremental = DUK_HEAP_MS_INCR_SWEEP;
+		heap->ms_sweep_curr = heap->ms_sweep_start;
+	}
+
+	DUK_ASSERT(heap->ms_incremental == DUK_HEAP_MS_INCR_SWEEP);
+	while ((curr = heap->ms_sweep_curr) != NULL) {
+		if (budget <= 0) {
+			goto yield;
+		}
+		budget--;
+		heap->ms_sweep_curr = DUK_HEAPHDR_GET_NEXT(heap, curr);
+		duk__sweep_incremental_object(heap, curr);
+	}
+
+	duk__sweep_stringtable(heap, &count_keep_str);
+	heap->ms_incremental = DUK_HEAP_MS_INCR_IDLE;
+	heap->ms_sweep_start = NULL;
+	heap->ms_sweep_curr = NULL;
+
+	DUK_ASSERT(heap->ms_prevent_count == 1);
+	DUK_ASSERT(heap->ms_running == 1);
+	heap->ms_prevent_count = 0;
+	heap->ms_running = 0;
+
+	tmp = (heap->ms_sweep_count + count_keep_str) / 256;
+	heap->ms_trigger_counter = (duk_int_t) (
+	    (tmp * DUK_HEAP_MARK_AND_SWEEP_TRIGGER_MULT) +
+	    DUK_HEAP_MARK_AND_SWEEP_TRIGGER_ADD);
+	DUK_D(DUK_DPRINT("incremental mark-and-sweep finished: %ld objects kept, %ld strings kept, trigger reset to %ld",
+	                 (long) heap->ms_sweep_count, (long) count_keep_str, (long) heap->ms_trigger_counter));
+	return 1;
+
+ yield:
+	DUK_ASSERT(heap->ms_prevent_count == 1);
+	DUK_ASSERT(heap->ms_running == 1);
+	heap->ms_prevent_count = 0;
+	heap->ms_running = 0;
+
+	heap->ms_trigger_counter = DUK_HEAP_MARK_AND_SWEEP_TRIGGER_STEP;
+	return 0;
+}
+#endif  /* DUK_USE_INCREMENTAL_GC */
+
 /*
  *  Litcache helpers.
  */
@@ -1162,17 +1637,17 @@ DUK_LOCAL void duk__dump_stats(duk_heap *heap) {
 	                 (long) heap->stats_getpropdesc_miss));
 	DUK_D(DUK_DPRINT("stats getprop: all=%ld, arrayidx=%ld, bufobjidx=%ld, "
 	                 "bufferidx=%ld, bufferlen=%ld, stringidx=%ld, stringlen=%ld, "
-	                 "proxy=%ld, arguments=%ld",
+	                 "proxy=%ld, arguments=%ld, entry=%ld",
 	                 (long) heap->stats_getprop_all, (long) heap->stats_getprop_arrayidx,
 	                 (long) heap->stats_getprop_bufobjidx, (long) heap->stats_getprop_bufferidx,
 	                 (long) heap->stats_getprop_bufferlen, (long) heap->stats_getprop_stringidx,
 	                 (long) heap->stats_getprop_stringlen, (long) heap->stats_getprop_proxy,
-	                 (long) heap->stats_getprop_arguments));
+	                 (long) heap->stats_getprop_arguments, (long) heap->stats_getprop_entry));
 	DUK_D(DUK_DPRINT("stats putprop: all=%ld, arrayidx=%ld, bufobjidx=%ld, "
-	                 "bufferidx=%ld, proxy=%ld",
+	                 "bufferidx=%ld, proxy=%ld, entry=%ld",
 	                 (long) heap->stats_putprop_all, (long) heap->stats_putprop_arrayidx,
 	                 (long) heap->stats_putprop_bufobjidx, (long) heap->stats_putprop_bufferidx,
-	                 (long) heap->stats_putprop_proxy));
+	                 (long) heap->stats_putprop_proxy, (long) heap->stats_putprop_entry));
 	DUK_D(DUK_DPRINT("stats getvar: all=%ld",
 	                 (long) heap->stats_getvar_all));
 	DUK_D(DUK_DPRINT("stats putvar: all=%ld",
@@ -1236,6 +1711,44 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 	                 (unsigned long) flags, (unsigned long) (flags | heap->ms_base_flags)));
 
 	flags |= heap->ms_base_flags;
+
+	/*
+	 *  Incremental step
+	 *
+	 *  Voluntary GC runs a bounded marking or sweeping step.  The step
+	 *  which completes marking continues below and sets up a sliced
+	 *  sweep.  Any other GC finishes a cycle in progress: marking is
+	 *  finished below, a pending sweep is finished here before running
+	 *  a full mark-and-sweep.
+	 */
+
+#if defined(DUK_USE_INCREMENTAL_GC)
+	if (flags & DUK_MS_FLAG_EMERGENCY) {
+		flags &= ~DUK_MS_FLAG_INCREMENTAL;
+	}
+	if (heap->ms_incremental >= DUK_HEAP_MS_INCR_FINALIZABLE) {
+		if (flags & DUK_MS_FLAG_INCREMENTAL) {
+			if (duk__sweep_incremental_step(heap, DUK_USE_INCREMENTAL_GC_BUDGET)) {
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+				duk_heap_process_finalize_list(heap);
+#endif
+			}
+			return;
+		}
+		(void) duk__sweep_incremental_step(heap, DUK_INT_MAX);
+		DUK_ASSERT(heap->ms_incremental == DUK_HEAP_MS_INCR_IDLE);
+	} else if (flags & DUK_MS_FLAG_INCREMENTAL) {
+		if (!duk__mark_incremental_step(heap)) {
+			heap->ms_trigger_counter = DUK_HEAP_MARK_AND_SWEEP_TRIGGER_STEP;
+			return;
+		}
+	} else if (heap->ms_incremental == DUK_HEAP_MS_INCR_MARK) {
+		duk__mark_incremental_abort(heap);
+	}
+	DUK_ASSERT(!(flags & DUK_MS_FLAG_INCREMENTAL) || heap->ms_incremental == DUK_HEAP_MS_INCR_MARK);
+	DUK_ASSERT((flags & DUK_MS_FLAG_INCREMENTAL) || heap->ms_incremental == DUK_HEAP_MS_INCR_IDLE);
+#endif
+
 #if defined(DUK_USE_FINALIZER_SUPPORT)
 	if (heap->finalize_list != NULL) {
 		flags |= DUK_MS_FLAG_POSTPONE_RESCUE;
@@ -1250,9 +1763,14 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 	DUK_ASSERT(heap->ms_prevent_count == 0);
 	DUK_ASSERT(heap->ms_running == 0);
 	DUK_ASSERT(!DUK_HEAP_HAS_DEBUGGER_PAUSED(heap));
-	DUK_ASSERT(!DUK_HEAP_HAS_MARKANDSWEEP_RECLIMIT_REACHED(heap));
 	DUK_ASSERT(heap->ms_recursion_depth == 0);
-	duk__assert_heaphdr_flags(heap);
+	if (!(flags & DUK_MS_FLAG_INCREMENTAL)) {
+		/* Incremental marking leaves marks (and possibly temproots)
+		 * in place until the cycle is finished.
+		 */
+		DUK_ASSERT(!DUK_HEAP_HAS_MARKANDSWEEP_RECLIMIT_REACHED(heap));
+		duk__assert_heaphdr_flags(heap);
+	}
 	duk__assert_validity(heap);
 #if defined(DUK_USE_REFERENCE_COUNTING)
 	/* Note: heap->refzero_free_running may be true; a refcount
@@ -1294,8 +1812,17 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 	 *  The heap finalize_list must also be marked as a reachability root.
 	 *  There may be objects on the list from a previous round if the
 	 *  previous run had finalizer skip flag.
+	 *
+	 *  When finishing an incremental cycle, the remaining gray objects
+	 *  are scanned first; already marked objects then terminate the
+	 *  normal marking below quickly.
 	 */
 
+#if defined(DUK_USE_INCREMENTAL_GC)
+	if (flags & DUK_MS_FLAG_INCREMENTAL) {
+		duk__mark_incremental_finish(heap);
+	}
+#endif
 #if defined(DUK_USE_ASSERTIONS) && defined(DUK_USE_REFERENCE_COUNTING)
 	duk__clear_assert_refcounts(heap);
 #endif
@@ -1308,6 +1835,29 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 #endif
 	duk__mark_temproots_by_heap_scan(heap);   /* Temproots. */
 
+#if defined(DUK_USE_INCREMENTAL_GC)
+	if (flags & DUK_MS_FLAG_INCREMENTAL) {
+		/* Marking from actual roots completed by a voluntary step:
+		 * leave finalizable objects and the sweep to the following
+		 * steps.  The finalize_list must be marked right away because
+		 * its objects may be queued back to heap_allocated before
+		 * the sweep is complete.
+		 */
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+		duk__mark_finalize_list(heap);
+		duk__mark_temproots_by_heap_scan(heap);
+		duk__clear_finalize_list_flags(heap);
+#endif
+		duk__sweep_incremental_begin(heap, flags);
+		DUK_ASSERT(heap->ms_prevent_count == 1);
+		DUK_ASSERT(heap->ms_running == 1);
+		heap->ms_prevent_count = 0;
+		heap->ms_running = 0;
+		heap->ms_trigger_counter = DUK_HEAP_MARK_AND_SWEEP_TRIGGER_STEP;
+		return;
+	}
+#endif
+
 #if defined(DUK_USE_FINALIZER_SUPPORT)
 	duk__mark_finalizable(heap);              /* Mark finalizable as reachability roots. */
 	duk__mark_finalize_list(heap);            /* Mark finalizer work list as reachability roots. */
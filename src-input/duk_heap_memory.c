@@ -51,6 +51,12 @@ DUK_LOCAL DUK_NOINLINE_PERF DUK_COLD void *duk__heap_mem_alloc_slowpath(duk_heap
 		if (i >= DUK_HEAP_ALLOC_FAIL_MARKANDSWEEP_EMERGENCY_LIMIT - 1) {
 			flags |= DUK_MS_FLAG_EMERGENCY;
 		}
+#if defined(DUK_USE_INCREMENTAL_GC)
+		if (i == 0 && heap->ms_trigger_counter < 0) {
+			/* Voluntary GC, bounded step only. */
+			flags |= DUK_MS_FLAG_INCREMENTAL;
+		}
+#endif
 
 		duk_heap_mark_and_sweep(heap, flags);
 
@@ -211,6 +217,12 @@ DUK_LOCAL DUK_NOINLINE_PERF DUK_COLD void *duk__heap_mem_realloc_slowpath(duk_he
 		if (i >= DUK_HEAP_ALLOC_FAIL_MARKANDSWEEP_EMERGENCY_LIMIT - 1) {
 			flags |= DUK_MS_FLAG_EMERGENCY;
 		}
+#if defined(DUK_USE_INCREMENTAL_GC)
+		if (i == 0 && heap->ms_trigger_counter < 0) {
+			/* Voluntary GC, bounded step only. */
+			flags |= DUK_MS_FLAG_INCREMENTAL;
+		}
+#endif
 
 		duk_heap_mark_and_sweep(heap, flags);
 
@@ -323,6 +335,12 @@ DUK_LOCAL DUK_NOINLINE_PERF DUK_COLD void *duk__heap_mem_realloc_indirect_slowpa
 		if (i >= DUK_HEAP_ALLOC_FAIL_MARKANDSWEEP_EMERGENCY_LIMIT - 1) {
 			flags |= DUK_MS_FLAG_EMERGENCY;
 		}
+#if defined(DUK_USE_INCREMENTAL_GC)
+		if (i == 0 && heap->ms_trigger_counter < 0) {
+			/* Voluntary GC, bounded step only. */
+			flags |= DUK_MS_FLAG_INCREMENTAL;
+		}
+#endif
 
 		duk_heap_mark_and_sweep(heap, flags);
 #if defined(DUK_USE_DEBUG)
@@ -63,6 +63,22 @@ DUK_INTERNAL void duk_heap_remove_from_heap_allocated(duk_heap *heap, duk_heaphd
 	} else {
 		;
 	}
+
+#if defined(DUK_USE_INCREMENTAL_GC)
+	/* An incremental sweep may be in progress: keep the sweep pointers
+	 * valid, and clear a stale mark so that an object moved to another
+	 * list (e.g. finalize_list) doesn't look marked in the next cycle.
+	 */
+	if (heap->ms_incremental >= DUK_HEAP_MS_INCR_FINALIZABLE) {
+		if (heap->ms_sweep_curr == hdr) {
+			heap->ms_sweep_curr = next;
+		}
+		if (heap->ms_sweep_start == hdr) {
+			heap->ms_sweep_start = next;
+		}
+		DUK_HEAPHDR_CLEAR_REACHABLE(hdr);
+	}
+#endif
 }
 #endif  /* DUK_USE_REFERENCE_COUNTING */
 
@@ -182,6 +182,13 @@ DUK_INTERNAL void duk_hobject_refcount_finalize_norz(duk_heap *heap, duk_hobject
 		DUK_HOBJECT_DECREF_NORZ(thr, p->target);
 		DUK_HOBJECT_DECREF_NORZ(thr, p->handler);
 #endif  /* DUK_USE_ES6_PROXY */
+#if defined(DUK_USE_MAP_BUILTIN)
+	} else if (DUK_HOBJECT_IS_HMAP(h)) {
+		duk_hmap *m = (duk_hmap *) h;
+		DUK_HMAP_ASSERT_VALID(m);
+		duk__decref_tvals_norz(thr, m->entries, (duk_idx_t) (m->e_next * DUK_HMAP_GET_STRIDE(m)));
+		DUK_HOBJECT_DECREF_NORZ_ALLOWNULL(thr, (duk_hobject *) m->gen);
+#endif  /* DUK_USE_MAP_BUILTIN */
 	} else if (DUK_HOBJECT_IS_THREAD(h)) {
 		duk_hthread *t = (duk_hthread *) h;
 		duk_activation *act;
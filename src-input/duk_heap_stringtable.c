@@ -24,6 +24,11 @@
 
 #define DUK__STRTAB_U32_MAX_STRLEN      10               /* 4'294'967'295 */
 
+/* Minimum byte length for in-place append, also the minimum capacity
+ * (power of two) of an appendable string.
+ */
+#define DUK__STRTAB_APPEND_MIN_BLEN     256
+
 /*
  *  Debug dump stringtable.
  */
@@ -703,6 +708,18 @@ DUK_LOCAL duk_hstring *duk__strtab_romstring_lookup(duk_heap *heap, const duk_ui
 }
 #endif  /* DUK_USE_ROM_STRINGS */
 
+/* While an incremental sweep is in progress unmarked strings are freed when
+ * the sweep ends.  A string which gets interned in the meantime is reachable
+ * again (or new), so mark it to keep it alive.
+ */
+#if defined(DUK_USE_INCREMENTAL_GC)
+#define DUK__STRTAB_SWEEP_MARK(heap,h) do { \
+		if (DUK_UNLIKELY((heap)->ms_incremental >= DUK_HEAP_MS_INCR_FINALIZABLE)) { \
+			DUK_HEAPHDR_SET_REACHABLE((duk_heaphdr *) (h)); \
+		} \
+	} while (0)
+#endif
+
 DUK_INTERNAL duk_hstring *duk_heap_strtable_intern(duk_heap *heap, const duk_uint8_t *str, duk_uint32_t blen) {
 	duk_uint32_t strhash;
 	duk_hstring *h;
@@ -733,6 +750,9 @@ DUK_INTERNAL duk_hstring *duk_heap_strtable_intern(duk_heap *heap, const duk_uin
 		    duk_memcmp_unsafe((const void *) str, (const void *) DUK_HSTRING_GET_DATA(h), (size_t) blen) == 0) {
 			/* Found existing entry. */
 			DUK_STATS_INC(heap, stats_strtab_intern_hit);
+#if defined(DUK_USE_INCREMENTAL_GC)
+			DUK__STRTAB_SWEEP_MARK(heap, h);
+#endif
 			return h;
 		}
 		h = h->hdr.h_next;
@@ -755,9 +775,207 @@ DUK_INTERNAL duk_hstring *duk_heap_strtable_intern(duk_heap *heap, const duk_uin
 
 	DUK_STATS_INC(heap, stats_strtab_intern_miss);
 	h = duk__strtable_do_intern(heap, str, blen, strhash);
+#if defined(DUK_USE_INCREMENTAL_GC)
+	if (h != NULL) {
+		DUK__STRTAB_SWEEP_MARK(heap, h);
+	}
+#endif
 	return h;  /* may be NULL */
 }
 
+/*
+ *  Append a string to another string, for 'x = x + y' style concatenation.
+ *
+ *  Building a string with repeated appends is O(n^2) if every step copies
+ *  the whole result into a new string.  When the left hand side is long and
+ *  its only reference is the one the result is written to, the result is
+ *  allocated with spare capacity (a power of two) and marked APPENDABLE.
+ *  Later appends then copy only the right hand side into the spare capacity
+ *  and rehash the string in place, which makes string building amortized
+ *  linear.  The result is an ordinary interned string: if an equal string
+ *  already exists in the string table, it is returned instead.
+ *
+ *  Returns NULL if the fast path doesn't apply or allocation fails; the
+ *  caller then falls back to ordinary concatenation.  On success caller
+ *  must replace its reference to 'h1' with the result without side effects
+ *  in between; the result may be 'h1' itself.
+ */
+
+#if defined(DUK_USE_HSTRING_APPEND)
+DUK_LOCAL duk_size_t duk__strtable_append_capacity(duk_size_t blen) {
+	duk_size_t cap;
+
+	/* Smallest power of two with room for the NUL terminator. */
+	cap = DUK__STRTAB_APPEND_MIN_BLEN;
+	while (cap <= blen) {
+		cap <<= 1;
+	}
+	return cap;
+}
+
+DUK_LOCAL duk_hstring *duk__strtable_append_lookup(duk_heap *heap, const duk_uint8_t *str, duk_uint32_t blen, duk_uint32_t strhash) {
+	duk_hstring *h;
+
+#if defined(DUK_USE_STRTAB_PTRCOMP)
+	h = DUK__HEAPPTR_DEC16(heap, heap->strtable16[strhash & heap->st_mask]);
+#else
+	h = heap->strtable[strhash & heap->st_mask];
+#endif
+	while (h != NULL) {
+		if (DUK_HSTRING_GET_HASH(h) == strhash &&
+		    DUK_HSTRING_GET_BYTELEN(h) == blen &&
+		    duk_memcmp((const void *) str, (const void *) DUK_HSTRING_GET_DATA(h), (size_t) blen) == 0) {
+#if defined(DUK_USE_INCREMENTAL_GC)
+			DUK__STRTAB_SWEEP_MARK(heap, h);
+#endif
+			return h;
+		}
+		h = h->hdr.h_next;
+	}
+#if defined(DUK_USE_ROM_STRINGS)
+	h = duk__strtab_romstring_lookup(heap, str, blen, strhash);
+#endif
+	return h;
+}
+
+DUK_LOCAL void duk__strtable_append_init(duk_heap *heap, duk_hstring *res, duk_uint32_t blen, duk_uint32_t strhash, duk_bool_t ascii, duk_size_t clen) {
+#if defined(DUK_USE_STRTAB_PTRCOMP)
+	duk_uint16_t *slot;
+#else
+	duk_hstring **slot;
+#endif
+
+	/* The result is long and doesn't begin with a symbol prefix byte
+	 * (the left hand side isn't a symbol), so it's never an array index
+	 * or a symbol.
+	 */
+	DUK_HSTRING_SET_BYTELEN(res, blen);
+	DUK_HSTRING_SET_HASH(res, strhash);
+	DUK_ASSERT(!DUK_HSTRING_HAS_ARRIDX(res));
+	DUK_ASSERT(!DUK_HSTRING_HAS_SYMBOL(res));
+#if defined(DUK_USE_HSTRING_ARRIDX)
+	res->arridx = DUK_HSTRING_NO_ARRAY_INDEX;
+#endif
+	if (ascii) {
+		DUK_HSTRING_SET_ASCII(res);
+	} else {
+		DUK_HSTRING_CLEAR_ASCII(res);
+	}
+#if defined(DUK_USE_HSTRING_CLEN)
+	DUK_HSTRING_SET_CHARLEN(res, clen);
+#else
+	DUK_UNREF(clen);
+#endif
+
+#if defined(DUK_USE_STRTAB_PTRCOMP)
+	slot = heap->strtable16 + (strhash & heap->st_mask);
+#else
+	slot = heap->strtable + (strhash & heap->st_mask);
+#endif
+	res->hdr.h_next = DUK__HEAPPTR_DEC16(heap, *slot);
+	*slot = DUK__HEAPPTR_ENC16(heap, res);
+#if defined(DUK__STRTAB_RESIZE_CHECK)
+	heap->st_count++;
+#endif
+}
+
+DUK_INTERNAL duk_hstring *duk_heap_strtable_append(duk_heap *heap, duk_hstring *h1, duk_hstring *h2) {
+	duk_uint32_t blen1;
+	duk_uint32_t blen2;
+	duk_uint32_t blen;
+	duk_uint32_t strhash;
+	duk_size_t clen;
+	duk_size_t cap;
+	duk_bool_t ascii;
+	duk_uint8_t *data;
+	duk_hstring *res;
+
+	DUK_ASSERT(heap != NULL);
+	DUK_ASSERT(h1 != NULL);
+	DUK_ASSERT(h2 != NULL);
+
+	blen1 = DUK_HSTRING_GET_BYTELEN(h1);
+	blen2 = DUK_HSTRING_GET_BYTELEN(h2);
+	blen = blen1 + blen2;
+	if (blen1 < DUK__STRTAB_APPEND_MIN_BLEN ||
+	    DUK_HEAPHDR_GET_REFCOUNT((duk_heaphdr *) h1) != 1 ||
+	    DUK_HEAPHDR_HAS_READONLY((duk_heaphdr *) h1) ||
+	    DUK_HSTRING_HAS_EXTDATA(h1) ||
+	    DUK_HSTRING_HAS_SYMBOL(h1) ||
+	    DUK_HSTRING_HAS_SYMBOL(h2) ||
+	    blen < blen1 ||  /* wrapped */
+	    blen > DUK_HSTRING_MAX_BYTELEN) {
+		return NULL;
+	}
+	DUK_ASSERT(!DUK_HSTRING_HAS_PINNED_LITERAL(h1));  /* Pinned literals have an extra reference. */
+
+	/* Charlen and ASCII flag of the result follow from the inputs.  For
+	 * h1 these are usually already computed.
+	 */
+	clen = DUK_HSTRING_GET_CHARLEN(h1) + DUK_HSTRING_GET_CHARLEN(h2);
+	ascii = DUK_HSTRING_HAS_ASCII(h1) && DUK_HSTRING_HAS_ASCII(h2);
+
+	if (DUK_HSTRING_HAS_APPENDABLE(h1) && (duk_size_t) blen < duk__strtable_append_capacity((duk_size_t) blen1)) {
+		/* Append in place.  The data beyond the current byte length
+		 * isn't visible, so h1 is intact if an existing string is
+		 * found (apart from the NUL terminator, restored below).
+		 */
+		data = (duk_uint8_t *) (h1 + 1);
+		duk_memcpy_unsafe((void *) (data + blen1), (const void *) DUK_HSTRING_GET_DATA(h2), (size_t) blen2);
+		strhash = duk_heap_hashstring(heap, (const duk_uint8_t *) data, (duk_size_t) blen);
+		res = duk__strtable_append_lookup(heap, (const duk_uint8_t *) data, blen, strhash);
+		if (res != NULL) {
+			data[blen1] = (duk_uint8_t) 0;
+			return res;
+		}
+		data[blen] = (duk_uint8_t) 0;
+		duk_heap_strtable_unlink(heap, h1);
+		duk__strtable_append_init(heap, h1, blen, strhash, ascii, clen);
+		return h1;
+	}
+
+	/* Allocate a new appendable string.  This may cause a GC; h1 and h2
+	 * are reachable through the caller and finalizers are prevented as
+	 * in duk__strtable_do_intern().
+	 */
+	cap = duk__strtable_append_capacity((duk_size_t) blen);
+	heap->pf_prevent_count++;
+	DUK_ASSERT(heap->pf_prevent_count != 0);  /* Wrap. */
+	res = (duk_hstring *) DUK_ALLOC(heap, sizeof(duk_hstring) + cap);
+	DUK_ASSERT(heap->pf_prevent_count > 0);
+	heap->pf_prevent_count--;
+	if (DUK_UNLIKELY(res == NULL)) {
+		return NULL;
+	}
+
+	data = (duk_uint8_t *) (res + 1);
+	duk_memcpy((void *) data, (const void *) DUK_HSTRING_GET_DATA(h1), (size_t) blen1);
+	duk_memcpy_unsafe((void *) (data + blen1), (const void *) DUK_HSTRING_GET_DATA(h2), (size_t) blen2);
+	data[blen] = (duk_uint8_t) 0;
+	strhash = duk_heap_hashstring(heap, (const duk_uint8_t *) data, (duk_size_t) blen);
+	{
+		duk_hstring *h_exist;
+
+		h_exist = duk__strtable_append_lookup(heap, (const duk_uint8_t *) data, blen, strhash);
+		if (h_exist != NULL) {
+			DUK_FREE(heap, (void *) res);
+			return h_exist;
+		}
+	}
+
+	duk_memzero((void *) res, sizeof(duk_hstring));
+#if defined(DUK_USE_EXPLICIT_NULL_INIT)
+	DUK_HEAPHDR_STRING_INIT_NULLS(&res->hdr);
+#endif
+	DUK_HEAPHDR_SET_TYPE_AND_FLAGS(&res->hdr, DUK_HTYPE_STRING, DUK_HSTRING_FLAG_APPENDABLE);
+	duk__strtable_append_init(heap, res, blen, strhash, ascii, clen);
+#if defined(DUK_USE_INCREMENTAL_GC)
+	DUK__STRTAB_SWEEP_MARK(heap, res);
+#endif
+	return res;
+}
+#endif  /* DUK_USE_HSTRING_APPEND */
+
 /*
  *  Intern a string from u32.
  */
@@ -51,6 +51,10 @@ DUK_INTERNAL void duk_heaphdr_assert_valid_subclassed(duk_heaphdr *h) {
 			DUK_HBOUNDFUNC_ASSERT_VALID((duk_hboundfunc *) h_obj);
 		} else if (DUK_HOBJECT_IS_PROXY(h_obj)) {
 			DUK_HPROXY_ASSERT_VALID((duk_hproxy *) h_obj);
+		} else if (DUK_HOBJECT_IS_HMAP(h_obj)) {
+#if defined(DUK_USE_MAP_BUILTIN)
+			DUK_HMAP_ASSERT_VALID((duk_hmap *) h_obj);
+#endif
 		} else if (DUK_HOBJECT_IS_THREAD(h_obj)) {
 			DUK_HTHREAD_ASSERT_VALID((duk_hthread *) h_obj);
 		} else {
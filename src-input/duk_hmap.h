@@ -0,0 +1,74 @@
+/*
+ *  Map and Set object representation.
+ *
+ *  Entries are kept in insertion order in a separately allocated entry
+ *  array.  A Map entry is a key and a value, a Set entry is just the key.
+ *  Deleted entries are marked by an UNUSED key (and an undefined value)
+ *  and are dropped when the entry array is compacted.
+ *
+ *  The entry array is followed by an open addressing hash index with
+ *  linear probing.  The index has twice as many slots as there are
+ *  entries so it never fills up; a slot holds an entry index plus one,
+ *  zero marks an empty slot.  Index slots of deleted entries remain in
+ *  place until compaction and act as tombstones because an UNUSED key
+ *  never compares equal.
+ *
+ *  Memory layout of the separate allocation:
+ *
+ *    duk_tval entries[e_size * stride];  (stride = 2 for Map, 1 for Set)
+ *    duk_uint32_t index[e_size * 2];
+ *
+ *  Iterators and forEach() refer to entries by position.  When the entry
+ *  array is compacted, positions of later entries shift down.  If some
+ *  iterator has observed the current entry array ('gen' is set), the
+ *  compaction is recorded in a new generation record: an array whose
+ *  index 0 links the previous record to the next one, and whose remaining
+ *  elements are the (ascending) positions dropped by the compaction.
+ *  An iterator holding an older record walks the chain to translate its
+ *  position.  When no iterator exists, records are freed by refcounting.
+ */
+
+#if !defined(DUK_HMAP_H_INCLUDED)
+#define DUK_HMAP_H_INCLUDED
+
+/* Maximum entry array size, keeps allocation size computation within
+ * 32 bits.
+ */
+#define DUK_HMAP_MAX_ENTRIES            0x04000000UL
+
+/* Minimum nonzero entry array size. */
+#define DUK_HMAP_MIN_ENTRIES            4
+
+#define DUK_HMAP_IS_SET(h)              (DUK_HOBJECT_GET_CLASS_NUMBER((duk_hobject *) (h)) == DUK_HOBJECT_CLASS_SET)
+#define DUK_HMAP_GET_STRIDE(h)          (DUK_HMAP_IS_SET((h)) ? 1U : 2U)
+#define DUK_HMAP_GET_INDEX(h) \
+	((duk_uint32_t *) (void *) ((h)->entries + (h)->e_size * DUK_HMAP_GET_STRIDE((h))))
+#define DUK_HMAP_GET_INDEX_MASK(h)      ((h)->e_size * 2U - 1U)
+#define DUK_HMAP_COMPUTE_ALLOC_SIZE(e_size,stride) \
+	((duk_size_t) (e_size) * ((stride) * sizeof(duk_tval) + 2U * sizeof(duk_uint32_t)))
+
+#if defined(DUK_USE_ASSERTIONS)
+DUK_INTERNAL_DECL void duk_hmap_assert_valid(duk_hmap *h);
+#define DUK_HMAP_ASSERT_VALID(h)  do { duk_hmap_assert_valid((h)); } while (0)
+#else
+#define DUK_HMAP_ASSERT_VALID(h)  do {} while (0)
+#endif
+
+struct duk_hmap {
+	/* Shared object part. */
+	duk_hobject obj;
+
+	/* Entry array and hash index, separate allocation (NULL if e_size
+	 * is zero).
+	 */
+	duk_tval *entries;
+
+	/* Current generation record if observed by an iterator, else NULL. */
+	duk_harray *gen;
+
+	duk_uint32_t e_size;  /* allocated entries, zero or a power of two */
+	duk_uint32_t e_next;  /* next free entry position */
+	duk_uint32_t count;   /* live (non-deleted) entries */
+};
+
+#endif  /* DUK_HMAP_H_INCLUDED */
@@ -111,10 +111,14 @@
 #define DUK_HOBJECT_CLASS_FLOAT32ARRAY         28
 #define DUK_HOBJECT_CLASS_FLOAT64ARRAY         29
 #define DUK_HOBJECT_CLASS_BUFOBJ_MAX           29
-#define DUK_HOBJECT_CLASS_MAX                  29
+#define DUK_HOBJECT_CLASS_HMAP_MIN             30
+#define DUK_HOBJECT_CLASS_MAP                  30  /* implies DUK_HOBJECT_IS_HMAP */
+#define DUK_HOBJECT_CLASS_SET                  31
+#define DUK_HOBJECT_CLASS_HMAP_MAX             31
+#define DUK_HOBJECT_CLASS_MAX                  31
 
 /* Class masks. */
-#define DUK_HOBJECT_CMASK_ALL                  ((1UL << (DUK_HOBJECT_CLASS_MAX + 1)) - 1UL)
+#define DUK_HOBJECT_CMASK_ALL                  (((1UL << DUK_HOBJECT_CLASS_MAX) - 1UL) | (1UL << DUK_HOBJECT_CLASS_MAX))
 #define DUK_HOBJECT_CMASK_NONE                 (1UL << DUK_HOBJECT_CLASS_NONE)
 #define DUK_HOBJECT_CMASK_ARGUMENTS            (1UL << DUK_HOBJECT_CLASS_ARGUMENTS)
 #define DUK_HOBJECT_CMASK_ARRAY                (1UL << DUK_HOBJECT_CLASS_ARRAY)
@@ -144,6 +148,8 @@
 #define DUK_HOBJECT_CMASK_UINT32ARRAY          (1UL << DUK_HOBJECT_CLASS_UINT32ARRAY)
 #define DUK_HOBJECT_CMASK_FLOAT32ARRAY         (1UL << DUK_HOBJECT_CLASS_FLOAT32ARRAY)
 #define DUK_HOBJECT_CMASK_FLOAT64ARRAY         (1UL << DUK_HOBJECT_CLASS_FLOAT64ARRAY)
+#define DUK_HOBJECT_CMASK_MAP                  (1UL << DUK_HOBJECT_CLASS_MAP)
+#define DUK_HOBJECT_CMASK_SET                  (1UL << DUK_HOBJECT_CLASS_SET)
 
 #define DUK_HOBJECT_CMASK_ALL_BUFOBJS \
 	(DUK_HOBJECT_CMASK_ARRAYBUFFER | \
@@ -176,6 +182,11 @@
 #else
 #define DUK_HOBJECT_IS_PROXY(h)                0
 #endif
+#if defined(DUK_USE_MAP_BUILTIN)
+#define DUK_HOBJECT_IS_HMAP(h)                 (DUK_HOBJECT_GET_CLASS_NUMBER((h)) >= DUK_HOBJECT_CLASS_HMAP_MIN)
+#else
+#define DUK_HOBJECT_IS_HMAP(h)                 0
+#endif
 
 #define DUK_HOBJECT_IS_NONBOUND_FUNCTION(h)    DUK_HEAPHDR_CHECK_FLAG_BITS(&(h)->hdr, \
                                                         DUK_HOBJECT_FLAG_COMPFUNC | \
@@ -288,7 +299,7 @@
 #define DUK_HOBJECT_PROHIBITS_FASTREFS(h) \
 	(DUK_HOBJECT_IS_COMPFUNC((h)) || DUK_HOBJECT_IS_DECENV((h)) || DUK_HOBJECT_IS_OBJENV((h)) || \
 	 DUK_HOBJECT_IS_BUFOBJ((h)) || DUK_HOBJECT_IS_THREAD((h)) || DUK_HOBJECT_IS_PROXY((h)) || \
-	 DUK_HOBJECT_IS_BOUNDFUNC((h)))
+	 DUK_HOBJECT_IS_BOUNDFUNC((h)) || DUK_HOBJECT_IS_HMAP((h)))
 #define DUK_HOBJECT_ALLOWS_FASTREFS(h) (!DUK_HOBJECT_PROHIBITS_FASTREFS((h)))
 
 /* Flags used for property attributes in duk_propdesc and packed flags.
@@ -871,6 +882,9 @@ DUK_INTERNAL_DECL duk_hthread *duk_hthread_alloc(duk_hthread *thr, duk_uint_t ho
 DUK_INTERNAL_DECL duk_hdecenv *duk_hdecenv_alloc(duk_hthread *thr, duk_uint_t hobject_flags);
 DUK_INTERNAL_DECL duk_hobjenv *duk_hobjenv_alloc(duk_hthread *thr, duk_uint_t hobject_flags);
 DUK_INTERNAL_DECL duk_hproxy *duk_hproxy_alloc(duk_hthread *thr, duk_uint_t hobject_flags);
+#if defined(DUK_USE_MAP_BUILTIN)
+DUK_INTERNAL_DECL duk_hmap *duk_hmap_alloc(duk_hthread *thr, duk_uint_t hobject_flags);
+#endif
 
 /* resize */
 DUK_INTERNAL_DECL void duk_hobject_realloc_props(duk_hthread *thr,
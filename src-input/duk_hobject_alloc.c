@@ -37,6 +37,17 @@ DUK_LOCAL void duk__init_object_parts(duk_heap *heap, duk_uint_t hobject_flags,
 	DUK_HEAPHDR_ASSERT_LINKS(heap, &obj->hdr);
 	DUK_HEAP_INSERT_INTO_HEAP_ALLOCATED(heap, &obj->hdr);
 
+#if defined(DUK_USE_INCREMENTAL_GC)
+	/* Objects created while incremental marking is in progress are
+	 * born marked: they have no children yet and any they get later go
+	 * through the INCREF write barrier.  Objects created while sweeping
+	 * are inserted before the sweep start point and are not swept.
+	 */
+	if (heap->ms_incremental == DUK_HEAP_MS_INCR_MARK) {
+		DUK_HEAPHDR_SET_REACHABLE(&obj->hdr);
+	}
+#endif
+
 	/* obj->props is intentionally left as NULL, and duk_hobject_props.c must deal
 	 * with this properly.  This is intentional: empty objects consume a minimum
 	 * amount of memory.  Further, an initial allocation might fail and cause
@@ -53,6 +64,24 @@ DUK_LOCAL void *duk__hobject_alloc_init(duk_hthread *thr, duk_uint_t hobject_fla
 	return res;
 }
 
+#if defined(DUK_USE_CACHE_HOBJECT)
+/* Reuse a struct from an object freelist if available, see duk_free_hobject(). */
+DUK_LOCAL void *duk__hobject_alloc_init_cached(duk_hthread *thr, duk_uint_t hobject_flags, duk_size_t size, duk_hobject **freelist, duk_uint_t *count) {
+	duk_hobject *res;
+
+	res = *freelist;
+	if (DUK_LIKELY(res != NULL)) {
+		DUK_ASSERT(*count > 0);
+		*freelist = (duk_hobject *) DUK_HEAPHDR_GET_NEXT(thr->heap, &res->hdr);
+		(*count)--;
+		duk_memzero((void *) res, size);
+		duk__init_object_parts(thr->heap, hobject_flags, res);
+		return (void *) res;
+	}
+	return duk__hobject_alloc_init(thr, hobject_flags, size);
+}
+#endif  /* DUK_USE_CACHE_HOBJECT */
+
 /*
  *  Allocate an duk_hobject.
  *
@@ -89,7 +118,11 @@ DUK_INTERNAL duk_hobject *duk_hobject_alloc_unchecked(duk_heap *heap, duk_uint_t
 DUK_INTERNAL duk_hobject *duk_hobject_alloc(duk_hthread *thr, duk_uint_t hobject_flags) {
 	duk_hobject *res;
 
+#if defined(DUK_USE_CACHE_HOBJECT)
+	res = (duk_hobject *) duk__hobject_alloc_init_cached(thr, hobject_flags, sizeof(duk_hobject), &thr->heap->hobject_free, &thr->heap->hobject_free_count);
+#else
 	res = (duk_hobject *) duk__hobject_alloc_init(thr, hobject_flags, sizeof(duk_hobject));
+#endif
 	return res;
 }
 
@@ -187,6 +220,10 @@ DUK_INTERNAL duk_hthread *duk_hthread_alloc_unchecked(duk_heap *heap, duk_uint_t
 	res->callstack_curr = NULL;
 	res->resumer = NULL;
 	res->compile_ctx = NULL,
+#if defined(DUK_USE_INCREMENTAL_GC)
+	res->ms_thr_prev = NULL;
+	res->ms_thr_next = NULL;
+#endif
 #if defined(DUK_USE_HEAPPTR16)
 	res->strs16 = NULL;
 #else
@@ -203,6 +240,9 @@ DUK_INTERNAL duk_hthread *duk_hthread_alloc_unchecked(duk_heap *heap, duk_uint_t
 	DUK_ASSERT(res->strict == 0);
 
 	res->heap = heap;
+#if defined(DUK_USE_INCREMENTAL_GC)
+	duk_heap_insert_into_threads(heap, res);
+#endif
 
 	/* XXX: Any reason not to merge duk_hthread_alloc.c here? */
 	return res;
@@ -222,7 +262,11 @@ DUK_INTERNAL duk_hthread *duk_hthread_alloc(duk_hthread *thr, duk_uint_t hobject
 DUK_INTERNAL duk_harray *duk_harray_alloc(duk_hthread *thr, duk_uint_t hobject_flags) {
 	duk_harray *res;
 
+#if defined(DUK_USE_CACHE_HOBJECT)
+	res = (duk_harray *) duk__hobject_alloc_init_cached(thr, hobject_flags, sizeof(duk_harray), &thr->heap->harray_free, &thr->heap->harray_free_count);
+#else
 	res = (duk_harray *) duk__hobject_alloc_init(thr, hobject_flags, sizeof(duk_harray));
+#endif
 
 	DUK_ASSERT(res->length == 0);
 
@@ -269,3 +313,23 @@ DUK_INTERNAL duk_hproxy *duk_hproxy_alloc(duk_hthread *thr, duk_uint_t hobject_f
 
 	return res;
 }
+
+#if defined(DUK_USE_MAP_BUILTIN)
+DUK_INTERNAL duk_hmap *duk_hmap_alloc(duk_hthread *thr, duk_uint_t hobject_flags) {
+	duk_hmap *res;
+
+	res = (duk_hmap *) duk__hobject_alloc_init(thr, hobject_flags, sizeof(duk_hmap));
+#if defined(DUK_USE_EXPLICIT_NULL_INIT)
+	res->entries = NULL;
+	res->gen = NULL;
+#endif
+
+	DUK_ASSERT(res->entries == NULL);
+	DUK_ASSERT(res->gen == NULL);
+	DUK_ASSERT(res->e_size == 0);
+	DUK_ASSERT(res->e_next == 0);
+	DUK_ASSERT(res->count == 0);
+
+	return res;
+}
+#endif  /* DUK_USE_MAP_BUILTIN */
@@ -100,6 +100,18 @@ DUK_INTERNAL void duk_hproxy_assert_valid(duk_hproxy *h) {
 	DUK_ASSERT(DUK_HOBJECT_HAS_EXOTIC_PROXYOBJ((duk_hobject *) h));
 }
 
+#if defined(DUK_USE_MAP_BUILTIN)
+DUK_INTERNAL void duk_hmap_assert_valid(duk_hmap *h) {
+	DUK_ASSERT(h != NULL);
+	DUK_ASSERT(DUK_HOBJECT_IS_HMAP((duk_hobject *) h));
+	DUK_ASSERT(h->e_size == 0 || (h->e_size >= DUK_HMAP_MIN_ENTRIES && (h->e_size & (h->e_size - 1U)) == 0));
+	DUK_ASSERT(h->e_size <= DUK_HMAP_MAX_ENTRIES);
+	DUK_ASSERT((h->e_size == 0 && h->entries == NULL) || (h->e_size > 0 && h->entries != NULL));
+	DUK_ASSERT(h->e_next <= h->e_size);
+	DUK_ASSERT(h->count <= h->e_next);
+}
+#endif  /* DUK_USE_MAP_BUILTIN */
+
 DUK_INTERNAL void duk_hthread_assert_valid(duk_hthread *thr) {
 	DUK_ASSERT(thr != NULL);
 	DUK_ASSERT(DUK_HEAPHDR_GET_TYPE((duk_heaphdr *) thr) == DUK_HTYPE_OBJECT);
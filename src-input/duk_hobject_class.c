@@ -88,6 +88,12 @@
 #if (DUK_STRIDX_FLOAT64_ARRAY > 255)
 #error constant too large
 #endif
+#if (DUK_STRIDX_UC_MAP > 255)
+#error constant too large
+#endif
+#if (DUK_STRIDX_UC_SET > 255)
+#error constant too large
+#endif
 #if (DUK_STRIDX_EMPTY_STRING > 255)
 #error constant too large
 #endif
@@ -124,6 +130,6 @@ DUK_INTERNAL duk_uint8_t duk_class_number_to_stridx[32] = {
 	DUK_STRIDX_UINT32_ARRAY,
 	DUK_STRIDX_FLOAT32_ARRAY,
 	DUK_STRIDX_FLOAT64_ARRAY,
-	DUK_STRIDX_EMPTY_STRING,  /* UNUSED, intentionally empty */
-	DUK_STRIDX_EMPTY_STRING,  /* UNUSED, intentionally empty */
+	DUK_STRIDX_UC_MAP,
+	DUK_STRIDX_UC_SET,
 };
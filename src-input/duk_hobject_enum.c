@@ -178,17 +178,92 @@ DUK_LOCAL void duk__sort_enum_keys_es6(duk_hthread *thr, duk_hobject *h_obj, duk
 
 DUK_LOCAL void duk__add_enum_key(duk_hthread *thr, duk_hstring *k) {
 	/* 'k' may be unreachable on entry so must push without any
-	 * potential for GC.
+	 * potential for GC.  The enumerator is a bare object so a define
+	 * is equivalent to a put; an existing key (shadowed by an earlier
+	 * inheritance level) keeps its position.
 	 */
 	duk_push_hstring(thr, k);
 	duk_push_true(thr);
-	duk_put_prop(thr, -3);
+	duk_xdef_prop_wec(thr, -3);
 }
 
 DUK_LOCAL void duk__add_enum_key_stridx(duk_hthread *thr, duk_small_uint_t stridx) {
 	duk__add_enum_key(thr, DUK_HTHREAD_GET_STRING(thr, stridx));
 }
 
+/* Count the keys the enumerator will contain for 'curr' and its prototype
+ * chain, so that the enumerator entry part can be allocated once instead of
+ * growing it key by key.  Keys shadowed by an earlier inheritance level are
+ * counted twice, which is harmless: the enumerator is compacted afterwards
+ * if the count was too large.
+ */
+DUK_LOCAL duk_uint32_t duk__count_enum_keys(duk_hthread *thr, duk_hobject *curr, duk_small_uint_t enum_flags) {
+	duk_uint_fast32_t i;
+	duk_uint32_t count = 0;
+	duk_uint32_t limit = DUK_HOBJECT_MAX_PROPERTIES - DUK__ENUM_START_INDEX;
+
+	while (curr != NULL) {
+		if (!(enum_flags & DUK_ENUM_EXCLUDE_STRINGS)) {
+			duk_uint32_t n_virtual = 0;
+
+			if (DUK_HOBJECT_HAS_EXOTIC_STRINGOBJ(curr)) {
+				duk_hstring *h_val;
+				h_val = duk_hobject_get_internal_value_string(thr->heap, curr);
+				if (h_val != NULL) {
+					n_virtual = (duk_uint32_t) DUK_HSTRING_GET_CHARLEN(h_val);
+				}
+			}
+#if defined(DUK_USE_BUFFEROBJECT_SUPPORT)
+			else if (DUK_HOBJECT_IS_BUFOBJ(curr)) {
+				duk_hbufobj *h_bufobj = (duk_hbufobj *) curr;
+				if (h_bufobj->is_typedarray) {
+					n_virtual = (duk_uint32_t) (h_bufobj->length >> h_bufobj->shift);
+				}
+			}
+#endif
+			if (n_virtual > limit) {
+				return 0;
+			}
+			count += n_virtual;
+			if (count > limit) {
+				return 0;
+			}
+
+			for (i = 0; i < (duk_uint_fast32_t) DUK_HOBJECT_GET_ASIZE(curr); i++) {
+				if (!DUK_TVAL_IS_UNUSED(DUK_HOBJECT_A_GET_VALUE_PTR(thr->heap, curr, i))) {
+					count++;
+				}
+			}
+			if (DUK_HOBJECT_HAS_EXOTIC_ARRAY(curr) && (enum_flags & DUK_ENUM_INCLUDE_NONENUMERABLE)) {
+				count++;
+			}
+		}
+		for (i = 0; i < (duk_uint_fast32_t) DUK_HOBJECT_GET_ENEXT(curr); i++) {
+			duk_hstring *k;
+
+			k = DUK_HOBJECT_E_GET_KEY(thr->heap, curr, i);
+			if (k == NULL ||
+			    (!(enum_flags & DUK_ENUM_INCLUDE_NONENUMERABLE) &&
+			     !DUK_HOBJECT_E_SLOT_IS_ENUMERABLE(thr->heap, curr, i))) {
+				continue;
+			}
+			if (DUK_HSTRING_HAS_SYMBOL(k) && !(enum_flags & DUK_ENUM_INCLUDE_SYMBOLS)) {
+				continue;
+			}
+			count++;
+		}
+		if (count > limit) {
+			/* Don't bother, the enumerator grows as needed. */
+			return 0;
+		}
+		if (enum_flags & DUK_ENUM_OWN_PROPERTIES_ONLY) {
+			break;
+		}
+		curr = DUK_HOBJECT_GET_PROTOTYPE(thr->heap, curr);
+	}
+	return count;
+}
+
 DUK_INTERNAL void duk_hobject_enumerator_create(duk_hthread *thr, duk_small_uint_t enum_flags) {
 	duk_hobject *enum_target;
 	duk_hobject *curr;
@@ -301,6 +376,9 @@ DUK_INTERNAL void duk_hobject_enumerator_create(duk_hthread *thr, duk_small_uint
  skip_proxy:
 #endif  /* DUK_USE_ES6_PROXY */
 
+	/* Allocate the enumerator entry part once. */
+	duk_hobject_resize_entrypart(thr, res, DUK__ENUM_START_INDEX + duk__count_enum_keys(thr, enum_target, enum_flags));
+
 	curr = enum_target;
 	sort_start_index = DUK__ENUM_START_INDEX;
 	DUK_ASSERT(DUK_HOBJECT_GET_ENEXT(res) == DUK__ENUM_START_INDEX);
@@ -544,8 +622,12 @@ DUK_INTERNAL void duk_hobject_enumerator_create(duk_hthread *thr, duk_small_uint
 #if defined(DUK_USE_ES6_PROXY)
  compact_and_return:
 #endif
-	/* compact; no need to seal because object is internal */
-	duk_hobject_compact_props(thr, res);
+	/* compact; no need to seal because object is internal.  Not needed
+	 * when the entry part was allocated to the exact size.
+	 */
+	if (DUK_HOBJECT_GET_ENEXT(res) != DUK_HOBJECT_GET_ESIZE(res)) {
+		duk_hobject_compact_props(thr, res);
+	}
 
 	DUK_DDD(DUK_DDDPRINT("created enumerator object: %!iT", (duk_tval *) duk_get_tval(thr, -1)));
 }
@@ -562,6 +644,7 @@ DUK_INTERNAL duk_bool_t duk_hobject_enumerator_next(duk_hthread *thr, duk_bool_t
 	duk_hobject *e;
 	duk_hobject *enum_target;
 	duk_hstring *res = NULL;
+	duk_tval *tv_next;
 	duk_uint_fast32_t idx;
 	duk_bool_t check_existence;
 
@@ -571,10 +654,39 @@ DUK_INTERNAL duk_bool_t duk_hobject_enumerator_next(duk_hthread *thr, duk_bool_t
 
 	e = duk_require_hobject(thr, -1);
 
-	/* XXX use get tval ptr, more efficient */
-	duk_get_prop_stridx_short(thr, -1, DUK_STRIDX_INT_NEXT);
-	idx = (duk_uint_fast32_t) duk_require_uint(thr, -1);
-	duk_pop(thr);
+	/* The control properties are the first entries of an enumerator
+	 * created by duk_hobject_enumerator_create(), so they can normally
+	 * be accessed directly.  duk_next() may be called with an arbitrary
+	 * object, so fall back to property lookups otherwise.
+	 */
+	tv_next = NULL;
+	if (DUK_HOBJECT_GET_ENEXT(e) >= DUK__ENUM_START_INDEX &&
+	    DUK_HOBJECT_E_GET_KEY(thr->heap, e, 0) == DUK_HTHREAD_STRING_INT_TARGET(thr) &&
+	    DUK_HOBJECT_E_GET_KEY(thr->heap, e, 1) == DUK_HTHREAD_STRING_INT_NEXT(thr) &&
+	    !DUK_HOBJECT_E_SLOT_IS_ACCESSOR(thr->heap, e, 0) &&
+	    !DUK_HOBJECT_E_SLOT_IS_ACCESSOR(thr->heap, e, 1)) {
+		duk_tval *tv_target;
+
+		tv_target = DUK_HOBJECT_E_GET_VALUE_TVAL_PTR(thr->heap, e, 0);
+		tv_next = DUK_HOBJECT_E_GET_VALUE_TVAL_PTR(thr->heap, e, 1);
+		if (!DUK_TVAL_IS_OBJECT(tv_target) || !DUK_TVAL_IS_NUMBER(tv_next)) {
+			tv_next = NULL;
+		}
+	}
+
+	if (DUK_LIKELY(tv_next != NULL)) {
+		idx = (duk_uint_fast32_t) duk_double_to_uint32_t(DUK_TVAL_GET_NUMBER(tv_next));
+		enum_target = DUK_TVAL_GET_OBJECT(DUK_HOBJECT_E_GET_VALUE_TVAL_PTR(thr->heap, e, 0));
+	} else {
+		duk_get_prop_stridx_short(thr, -1, DUK_STRIDX_INT_NEXT);
+		idx = (duk_uint_fast32_t) duk_require_uint(thr, -1);
+		duk_pop(thr);
+
+		duk_xget_owndataprop_stridx_short(thr, -1, DUK_STRIDX_INT_TARGET);
+		enum_target = duk_require_hobject(thr, -1);
+		duk_pop(thr);  /* still reachable */
+	}
+	DUK_ASSERT(enum_target != NULL);
 	DUK_DDD(DUK_DDDPRINT("enumeration: index is: %ld", (long) idx));
 
 	/* Enumeration keys are checked against the enumeration target (to see
@@ -582,15 +694,11 @@ DUK_INTERNAL duk_bool_t duk_hobject_enumerator_next(duk_hthread *thr, duk_bool_t
 	 * be the proxy, and checking key existence against the proxy is not
 	 * required (or sensible, as the keys may be fully virtual).
 	 */
-	duk_xget_owndataprop_stridx_short(thr, -1, DUK_STRIDX_INT_TARGET);
-	enum_target = duk_require_hobject(thr, -1);
-	DUK_ASSERT(enum_target != NULL);
 #if defined(DUK_USE_ES6_PROXY)
 	check_existence = (!DUK_HOBJECT_IS_PROXY(enum_target));
 #else
 	check_existence = 1;
 #endif
-	duk_pop(thr);  /* still reachable */
 
 	DUK_DDD(DUK_DDDPRINT("getting next enum value, enum_target=%!iO, enumerator=%!iT",
 	                     (duk_heaphdr *) enum_target, (duk_tval *) duk_get_tval(thr, -1)));
@@ -625,8 +733,18 @@ DUK_INTERNAL duk_bool_t duk_hobject_enumerator_next(duk_hthread *thr, duk_bool_t
 
 	DUK_DDD(DUK_DDDPRINT("enumeration: updating next index to %ld", (long) idx));
 
-	duk_push_u32(thr, (duk_uint32_t) idx);
-	duk_put_prop_stridx_short(thr, -2, DUK_STRIDX_INT_NEXT);
+	if (DUK_LIKELY(tv_next != NULL)) {
+		/* Re-lookup: a GC may have compacted the enumerator, but
+		 * the control properties keep their positions.
+		 */
+		DUK_ASSERT(DUK_HOBJECT_E_GET_KEY(thr->heap, e, 1) == DUK_HTHREAD_STRING_INT_NEXT(thr));
+		tv_next = DUK_HOBJECT_E_GET_VALUE_TVAL_PTR(thr->heap, e, 1);
+		DUK_ASSERT(DUK_TVAL_IS_NUMBER(tv_next));
+		DUK_TVAL_SET_U32(tv_next, (duk_uint32_t) idx);  /* number, no refcount */
+	} else {
+		duk_push_u32(thr, (duk_uint32_t) idx);
+		duk_put_prop_stridx_short(thr, -2, DUK_STRIDX_INT_NEXT);
+	}
 
 	/* [... enum] */
 
@@ -653,6 +771,82 @@ DUK_INTERNAL duk_bool_t duk_hobject_enumerator_next(duk_hthread *thr, duk_bool_t
  *  described in E5 Section 15.2.3.14.
  */
 
+#if !defined(DUK_USE_PREFER_SIZE)
+/* Fast path for Object.keys() of an ordinary object whose own properties
+ * are all in the entry part: copy the enumerable string keys directly into
+ * the result without creating an enumerator.  Keys are already in ES2015
+ * order unless there are array index keys, which need a sort; return 0
+ * without side effects for such objects and let the caller use the
+ * enumerator.
+ */
+DUK_LOCAL duk_bool_t duk__get_enumerated_keys_fastpath(duk_hthread *thr, duk_hobject *obj) {
+	duk_uint_fast32_t i;
+	duk_uint32_t count;
+	duk_uint32_t n;
+	duk_tval *tv;
+
+	if (DUK_HOBJECT_GET_ASIZE(obj) != 0 ||
+	    DUK_HOBJECT_HAS_EXOTIC_STRINGOBJ(obj) ||
+	    DUK_HOBJECT_IS_BUFOBJ(obj) ||
+	    DUK_HOBJECT_IS_PROXY(obj)) {
+		return 0;
+	}
+
+	count = 0;
+	for (i = 0; i < (duk_uint_fast32_t) DUK_HOBJECT_GET_ENEXT(obj); i++) {
+		duk_hstring *k;
+
+		k = DUK_HOBJECT_E_GET_KEY(thr->heap, obj, i);
+		if (k == NULL || !DUK_HOBJECT_E_SLOT_IS_ENUMERABLE(thr->heap, obj, i) ||
+		    DUK_HSTRING_HAS_SYMBOL(k)) {
+			continue;
+		}
+		if (DUK_HSTRING_HAS_ARRIDX(k)) {
+			return 0;
+		}
+		count++;
+	}
+
+	/* The result allocation may trigger a GC which may run finalizers
+	 * that modify the object, so the copy loop is bounds checked and
+	 * the caller falls back to the enumerator if anything changed.
+	 */
+	tv = duk_push_harray_with_size_outptr(thr, count);
+	DUK_ASSERT(count == 0 || tv != NULL);
+
+	n = 0;
+	if (DUK_HOBJECT_GET_ASIZE(obj) != 0) {
+		goto fail_pop;
+	}
+	for (i = 0; i < (duk_uint_fast32_t) DUK_HOBJECT_GET_ENEXT(obj); i++) {
+		duk_hstring *k;
+
+		k = DUK_HOBJECT_E_GET_KEY(thr->heap, obj, i);
+		if (k == NULL || !DUK_HOBJECT_E_SLOT_IS_ENUMERABLE(thr->heap, obj, i) ||
+		    DUK_HSTRING_HAS_SYMBOL(k)) {
+			continue;
+		}
+		if (n >= count || DUK_HSTRING_HAS_ARRIDX(k)) {
+			goto fail_pop;
+		}
+		DUK_ASSERT(DUK_TVAL_IS_UNUSED(tv + n));
+		DUK_TVAL_SET_STRING(tv + n, k);
+		DUK_HSTRING_INCREF(thr, k);
+		n++;
+	}
+	if (n != count) {
+		goto fail_pop;
+	}
+
+	/* [ ... enum_target res ] */
+	return 1;
+
+ fail_pop:
+	duk_pop(thr);
+	return 0;
+}
+#endif  /* !DUK_USE_PREFER_SIZE */
+
 DUK_INTERNAL duk_ret_t duk_hobject_get_enumerated_keys(duk_hthread *thr, duk_small_uint_t enum_flags) {
 	duk_hobject *e;
 	duk_hstring **keys;
@@ -662,6 +856,14 @@ DUK_INTERNAL duk_ret_t duk_hobject_get_enumerated_keys(duk_hthread *thr, duk_sma
 	DUK_ASSERT(thr != NULL);
 	DUK_ASSERT(duk_get_hobject(thr, -1) != NULL);
 
+#if !defined(DUK_USE_PREFER_SIZE)
+	if ((enum_flags & ~DUK_ENUM_NO_PROXY_BEHAVIOR) == DUK_ENUM_OWN_PROPERTIES_ONLY &&
+	    duk__get_enumerated_keys_fastpath(thr, duk_known_hobject(thr, -1))) {
+		/* [enum_target res] */
+		return 1;
+	}
+#endif
+
 	/* Create a temporary enumerator to get the (non-duplicated) key list;
 	 * the enumerator state is initialized without being needed, but that
 	 * has little impact.
@@ -740,6 +740,41 @@ DUK_INTERNAL void duk_hobject_realloc_props(duk_hthread *thr,
 
 	new_alloc_size = DUK_HOBJECT_P_COMPUTE_SIZE(new_e_size_adjusted, new_a_size, new_h_size);
 	DUK_DDD(DUK_DDDPRINT("new hobject allocation size is %ld", (long) new_alloc_size));
+
+	/* When an array part grows and there's no entry or hash part before
+	 * or after the resize (the common case for a growing Array), the
+	 * allocation consists of the array part only and can be resized in
+	 * place.  For large arrays this avoids copying the elements and
+	 * temporarily holding both the old and the new array part.  The old
+	 * allocation remains valid and reachable if a GC runs during the
+	 * realloc, and object compaction is prevented above.
+	 */
+	if (!abandon_array &&
+	    new_e_size_adjusted == 0 && new_h_size == 0 &&
+	    DUK_HOBJECT_GET_ESIZE(obj) == 0 && DUK_HOBJECT_GET_HSIZE(obj) == 0 &&
+	    new_a_size > DUK_HOBJECT_GET_ASIZE(obj)) {
+		DUK_ASSERT(DUK_HOBJECT_GET_ENEXT(obj) == 0);
+		DUK_ASSERT(new_alloc_size > 0);
+
+		new_p = (duk_uint8_t *) DUK_REALLOC(thr->heap, DUK_HOBJECT_GET_PROPS(thr->heap, obj), new_alloc_size);
+		if (new_p == NULL) {
+			/* Old allocation is untouched. */
+			goto alloc_failed;
+		}
+		new_a = (duk_tval *) (void *) new_p;
+		for (i = DUK_HOBJECT_GET_ASIZE(obj); i < new_a_size; i++) {
+			duk_tval *tv = &new_a[i];
+			DUK_TVAL_SET_UNUSED(tv);
+		}
+
+		DUK_DD(DUK_DDPRINT("resized hobject %p array part in place, a_size %ld -> %ld",
+		                   (void *) obj, (long) DUK_HOBJECT_GET_ASIZE(obj), (long) new_a_size));
+
+		DUK_HOBJECT_SET_PROPS(thr->heap, obj, new_p);
+		DUK_HOBJECT_SET_ASIZE(obj, new_a_size);
+		goto resize_done;
+	}
+
 	if (new_alloc_size == 0) {
 		DUK_ASSERT(new_e_size_adjusted == 0);
 		DUK_ASSERT(new_a_size == 0);
@@ -1020,6 +1055,7 @@ DUK_INTERNAL void duk_hobject_realloc_props(duk_hthread *thr,
 		DUK_HOBJECT_CLEAR_ARRAY_PART(obj);
 	}
 
+ resize_done:
 	DUK_DDD(DUK_DDDPRINT("resize result: %!O", (duk_heaphdr *) obj));
 
 	DUK_ASSERT(thr->heap->pf_prevent_count > 0);
@@ -2226,6 +2262,107 @@ DUK_LOCAL duk_bool_t duk__get_propdesc(duk_hthread *thr, duk_hobject *obj, duk_h
 	return 0;
 }
 
+/*
+ *  Fast path for reading and writing plain data properties using a string
+ *  key, e.g. 'obj.foo' or 'obj.foo = 123'.  The fast path avoids key coercion
+ *  (and the related value stack push/pop) and property descriptor handling,
+ *  and walks the prototype chain using entry part lookups directly.
+ *
+ *  The fast path applies only when the lookup can be resolved entirely from
+ *  entry parts:
+ *    - Key is a string which is not an array index.
+ *    - No object in the prototype chain (up to the object holding the
+ *      property) is a Proxy or has arguments exotic behavior.
+ *    - The property is found as a data property (not an accessor), and
+ *      no object skipped over in the chain has virtual properties (which
+ *      are checked after the entry part in the full algorithm).
+ *  Otherwise NULL/0 is returned and the caller must use the full algorithm.
+ *  The fast path has no side effects before it commits to a result.
+ */
+
+#if defined(DUK_USE_OBJECT_PROP_FASTPATH)
+DUK_LOCAL duk_tval *duk__getprop_fastpath_entry_tval(duk_hthread *thr, duk_hobject *obj, duk_tval *tv_key) {
+	duk_hstring *key;
+	duk_uint_t sanity;
+
+	if (!DUK_TVAL_IS_STRING(tv_key)) {
+		return NULL;
+	}
+	key = DUK_TVAL_GET_STRING(tv_key);
+	DUK_ASSERT(key != NULL);
+	if (DUK_HSTRING_HAS_ARRIDX(key)) {
+		return NULL;
+	}
+#if !defined(DUK_USE_NONSTD_FUNC_CALLER_PROPERTY)
+	if (key == DUK_HTHREAD_STRING_CALLER(thr)) {
+		/* 'caller' post-check is only in the full algorithm. */
+		return NULL;
+	}
+#endif
+
+	sanity = DUK_HOBJECT_PROTOTYPE_CHAIN_SANITY;
+	do {
+		duk_int_t e_idx;
+		duk_int_t h_idx;
+
+		if (DUK_UNLIKELY(DUK_HOBJECT_IS_PROXY(obj) || DUK_HOBJECT_HAS_EXOTIC_ARGUMENTS(obj))) {
+			return NULL;
+		}
+		if (duk_hobject_find_entry(thr->heap, obj, key, &e_idx, &h_idx)) {
+			if (DUK_UNLIKELY(DUK_HOBJECT_E_SLOT_IS_ACCESSOR(thr->heap, obj, e_idx))) {
+				return NULL;
+			}
+			DUK_DDD(DUK_DDDPRINT("-> entry part fast path successful"));
+			return DUK_HOBJECT_E_GET_VALUE_TVAL_PTR(thr->heap, obj, e_idx);
+		}
+		if (DUK_HOBJECT_HAS_VIRTUAL_PROPERTIES(obj)) {
+			return NULL;
+		}
+		obj = DUK_HOBJECT_GET_PROTOTYPE(thr->heap, obj);
+	} while (obj != NULL && --sanity > 0);
+
+	/* Not found or sanity limit reached: full algorithm deals with the
+	 * default value and the prototype chain limit error.
+	 */
+	return NULL;
+}
+
+DUK_LOCAL duk_bool_t duk__putprop_fastpath_entry_tval(duk_hthread *thr, duk_hobject *obj, duk_tval *tv_key, duk_tval *tv_val) {
+	duk_hstring *key;
+	duk_int_t e_idx;
+	duk_int_t h_idx;
+	duk_tval *tv;
+
+	DUK_ASSERT(!DUK_HEAPHDR_HAS_READONLY((duk_heaphdr *) obj));  /* caller ensures */
+
+	if (!DUK_TVAL_IS_STRING(tv_key)) {
+		return 0;
+	}
+	key = DUK_TVAL_GET_STRING(tv_key);
+	DUK_ASSERT(key != NULL);
+	if (DUK_HSTRING_HAS_ARRIDX(key) ||
+	    DUK_HOBJECT_IS_PROXY(obj) ||
+	    DUK_HOBJECT_HAS_EXOTIC_ARGUMENTS(obj)) {
+		return 0;
+	}
+
+	/* Only an existing own writable data property is updated; new
+	 * properties and inherited properties use the full algorithm.
+	 */
+	if (!duk_hobject_find_entry(thr->heap, obj, key, &e_idx, &h_idx)) {
+		return 0;
+	}
+	if ((DUK_HOBJECT_E_GET_FLAGS(thr->heap, obj, e_idx) &
+	     (DUK_PROPDESC_FLAG_WRITABLE | DUK_PROPDESC_FLAG_ACCESSOR)) != DUK_PROPDESC_FLAG_WRITABLE) {
+		return 0;
+	}
+
+	tv = DUK_HOBJECT_E_GET_VALUE_TVAL_PTR(thr->heap, obj, e_idx);
+	DUK_TVAL_SET_TVAL_UPDREF(thr, tv, tv_val);  /* side effects */
+	return 1;
+}
+#endif  /* DUK_USE_OBJECT_PROP_FASTPATH */
+
 /*
  *  Shallow fast path checks for accessing array elements with numeric
  *  indices.  The goal is to try to avoid coercing an array index to an
@@ -2561,6 +2698,9 @@ DUK_INTERNAL duk_bool_t duk_hobject_getprop(duk_hthread *thr, duk_tval *tv_obj,
 	case DUK_TAG_STRING: {
 		duk_hstring *h = DUK_TVAL_GET_STRING(tv_obj);
 		duk_int_t pop_count;
+#if defined(DUK_USE_OBJECT_PROP_FASTPATH)
+		duk_tval *tmp;
+#endif
 
 		if (DUK_UNLIKELY(DUK_HSTRING_HAS_SYMBOL(h))) {
 			/* Symbols (ES2015 or hidden) don't have virtual properties. */
@@ -2569,6 +2709,22 @@ DUK_INTERNAL duk_bool_t duk_hobject_getprop(duk_hthread *thr, duk_tval *tv_obj,
 			break;
 		}
 
+#if defined(DUK_USE_OBJECT_PROP_FASTPATH)
+		/* Method lookups like 'str.charCodeAt': any string key other
+		 * than 'length' and array indices is looked up from the String
+		 * prototype.
+		 */
+		if (DUK_TVAL_IS_STRING(tv_key) &&
+		    DUK_TVAL_GET_STRING(tv_key) != DUK_HTHREAD_STRING_LENGTH(thr)) {
+			tmp = duk__getprop_fastpath_entry_tval(thr, thr->builtins[DUK_BIDX_STRING_PROTOTYPE], tv_key);
+			if (tmp) {
+				duk_push_tval(thr, tmp);
+				DUK_STATS_INC(thr->heap, stats_getprop_entry);
+				return 1;
+			}
+		}
+#endif
+
 #if defined(DUK_USE_FASTINT)
 		if (DUK_TVAL_IS_FASTINT(tv_key)) {
 			arr_idx = duk__tval_fastint_to_arr_idx(tv_key);
@@ -2630,7 +2786,7 @@ DUK_INTERNAL duk_bool_t duk_hobject_getprop(duk_hthread *thr, duk_tval *tv_obj,
 	}
 
 	case DUK_TAG_OBJECT: {
-#if defined(DUK_USE_ARRAY_PROP_FASTPATH)
+#if defined(DUK_USE_ARRAY_PROP_FASTPATH) || defined(DUK_USE_OBJECT_PROP_FASTPATH)
 		duk_tval *tmp;
 #endif
 
@@ -2663,6 +2819,19 @@ DUK_INTERNAL duk_bool_t duk_hobject_getprop(duk_hthread *thr, duk_tval *tv_obj,
 		}
 #endif
 
+#if defined(DUK_USE_OBJECT_PROP_FASTPATH)
+		tmp = duk__getprop_fastpath_entry_tval(thr, curr, tv_key);
+		if (tmp) {
+			duk_push_tval(thr, tmp);
+
+			DUK_DDD(DUK_DDDPRINT("-> %!T (base is object, key is a string, entry part "
+			                     "fast path)",
+			                     (duk_tval *) duk_get_tval(thr, -1)));
+			DUK_STATS_INC(thr->heap, stats_getprop_entry);
+			return 1;
+		}
+#endif
+
 #if defined(DUK_USE_ES6_PROXY)
 		if (DUK_UNLIKELY(DUK_HOBJECT_IS_PROXY(curr))) {
 			duk_hobject *h_target;
@@ -3646,6 +3815,14 @@ DUK_INTERNAL duk_bool_t duk_hobject_putprop(duk_hthread *thr, duk_tval *tv_obj,
 		}
 #endif
 
+#if defined(DUK_USE_OBJECT_PROP_FASTPATH)
+		if (duk__putprop_fastpath_entry_tval(thr, orig, tv_key, tv_val) != 0) {
+			DUK_DDD(DUK_DDDPRINT("base is object, key is a string, entry part fast path"));
+			DUK_STATS_INC(thr->heap, stats_putprop_entry);
+			return 1;
+		}
+#endif
+
 #if defined(DUK_USE_ES6_PROXY)
 		if (DUK_UNLIKELY(DUK_HOBJECT_IS_PROXY(orig))) {
 			duk_hobject *h_target;
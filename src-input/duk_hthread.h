@@ -335,6 +335,12 @@ struct duk_hthread {
 	/* Current compiler state (if any), used for augmenting SyntaxErrors. */
 	duk_compiler_ctx *compile_ctx;
 
+#if defined(DUK_USE_INCREMENTAL_GC)
+	/* Linkage for heap->ms_threads. */
+	duk_hthread *ms_thr_prev;
+	duk_hthread *ms_thr_next;
+#endif
+
 #if defined(DUK_USE_INTERRUPT_COUNTER)
 	/* Interrupt counter for triggering a slow path check for execution
 	 * timeout, debugger interaction such as breakpoints, etc.  The value
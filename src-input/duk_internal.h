@@ -63,6 +63,7 @@
 #include "duk_henv.h"
 #include "duk_hbuffer.h"
 #include "duk_hproxy.h"
+#include "duk_hmap.h"
 #include "duk_heap.h"
 #include "duk_debugger.h"
 #include "duk_debug.h"
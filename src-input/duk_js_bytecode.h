@@ -406,10 +406,11 @@ typedef duk_uint32_t duk_instr_t;
 #define DUK_OP_GETPROPC_CR          209
 #define DUK_OP_GETPROPC_RC          210
 #define DUK_OP_GETPROPC_CC          211
-#define DUK_OP_UNUSED212            212
-#define DUK_OP_UNUSED213            213
-#define DUK_OP_UNUSED214            214
-#define DUK_OP_UNUSED215            215
+#define DUK_OP_ADDTMP               212  /* ADD with a dead temporary B, for 'x += y' */
+#define DUK_OP_ADDTMP_RR            212
+#define DUK_OP_ADDTMP_CR            213
+#define DUK_OP_ADDTMP_RC            214
+#define DUK_OP_ADDTMP_CC            215
 #define DUK_OP_UNUSED216            216
 #define DUK_OP_UNUSED217            217
 #define DUK_OP_UNUSED218            218
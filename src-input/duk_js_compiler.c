@@ -4569,6 +4569,14 @@ DUK_LOCAL void duk__expr_led(duk_compiler_ctx *comp_ctx, duk_ivalue *left, duk_i
 						reg_src = reg_temp;
 					}
 
+#if defined(DUK_USE_HSTRING_APPEND)
+					if (args_op == DUK_OP_ADD && reg_src == reg_temp) {
+						/* The temp is dead after the ADD, which
+						 * allows an in-place string append.
+						 */
+						args_op = DUK_OP_ADDTMP;
+					}
+#endif
 					duk__emit_a_b_c(comp_ctx,
 					                args_op | DUK__EMIT_FLAG_BC_REGCONST,
 					                reg_res,
@@ -147,6 +147,25 @@ DUK_LOCAL DUK_EXEC_ALWAYS_INLINE_PERF void duk__vm_arith_add(duk_hthread *thr, d
 		return;
 	}
 
+#if defined(DUK_USE_HSTRING_APPEND)
+	/* String append fast path for 'x = x + y' where the register is the
+	 * only reference to the string in 'x'.
+	 */
+	if (tv_x == thr->valstack_bottom + idx_z &&
+	    DUK_TVAL_IS_STRING(tv_x) && DUK_TVAL_IS_STRING(tv_y)) {
+		duk_hstring *h_res;
+
+		h_res = duk_heap_strtable_append(thr->heap, DUK_TVAL_GET_STRING(tv_x), DUK_TVAL_GET_STRING(tv_y));
+		if (h_res != NULL) {
+			duk_tval *tv_z;
+
+			tv_z = thr->valstack_bottom + idx_z;  /* Append may GC. */
+			DUK_TVAL_SET_STRING_UPDREF(thr, tv_z, h_res);  /* side effects */
+			return;
+		}
+	}
+#endif  /* DUK_USE_HSTRING_APPEND */
+
 	/*
 	 *  Slow path: potentially requires function calls for coercion
 	 */
@@ -182,6 +201,29 @@ DUK_LOCAL DUK_EXEC_ALWAYS_INLINE_PERF void duk__vm_arith_add(duk_hthread *thr, d
 	duk_replace(thr, (duk_idx_t) idx_z);  /* side effects */
 }
 
+
+/* ADDTMP is emitted for 'x += y' when 'x' is register bound and evaluating
+ * 'y' may have side effects: the pre-op value of 'x' is then copied to a
+ * temporary 'tv_x' which is dead after the operation.  Dropping the
+ * temporary's reference allows the string append fast path to extend the
+ * string in 'x' in place.
+ */
+DUK_LOCAL DUK_EXEC_NOINLINE_PERF void duk__vm_arith_addtmp(duk_hthread *thr, duk_tval *tv_x, duk_tval *tv_y, duk_small_uint_fast_t idx_z) {
+#if defined(DUK_USE_HSTRING_APPEND)
+	duk_tval *tv_z;
+
+	tv_z = thr->valstack_bottom + idx_z;
+	if (tv_x != tv_z && tv_x != tv_y &&
+	    DUK_TVAL_IS_STRING(tv_x) && DUK_TVAL_IS_STRING(tv_z) &&
+	    DUK_TVAL_GET_STRING(tv_x) == DUK_TVAL_GET_STRING(tv_z)) {
+		/* Both registers hold a reference so no refzero can happen. */
+		DUK_ASSERT(DUK_HEAPHDR_GET_REFCOUNT((duk_heaphdr *) DUK_TVAL_GET_STRING(tv_x)) >= 2);
+		DUK_TVAL_SET_UNDEFINED_UPDREF_NORZ(thr, tv_x);
+		tv_x = tv_z;
+	}
+#endif
+	duk__vm_arith_add(thr, tv_x, tv_y, idx_z);
+}
 DUK_LOCAL DUK_EXEC_ALWAYS_INLINE_PERF void duk__vm_arith_binary_op(duk_hthread *thr, duk_tval *tv_x, duk_tval *tv_y, duk_uint_fast_t idx_z, duk_small_uint_fast_t opcode) {
 	/*
 	 *  Arithmetic operations other than '+' have number-only semantics
@@ -3024,6 +3066,36 @@ DUK_INTERNAL void duk_js_execute_bytecode(duk_hthread *exec_thr) {
 	DUK_WO_NORETURN(return;);
 }
 
+/* Opcode dispatch.  By default the dispatch loop uses a single 'switch (op)'
+ * which compiles into one shared, poorly predicted indirect jump.  With
+ * DUK_USE_EXEC_COMPUTED_GOTO each case clause also gets a label and the
+ * dispatch jumps through a label address table (GCC/Clang "labels as
+ * values").  Opcode handlers then fetch and dispatch the next instruction
+ * directly so that each handler has its own indirect jump.  Not used with
+ * DUK_USE_EXEC_PREFER_SIZE which shares handlers between opcodes.
+ */
+#if defined(DUK_USE_EXEC_COMPUTED_GOTO) && !defined(DUK_USE_EXEC_PREFER_SIZE)
+#define DUK__EXEC_CGOTO
+#endif
+#if defined(DUK__EXEC_CGOTO)
+#define DUK__CASE(x)  case DUK_OP_##x: duk__op_##x
+#else
+#define DUK__CASE(x)  case DUK_OP_##x
+#endif
+
+/* Labels as values are a GCC/Clang extension; silence -Wpedantic for the
+ * inner executor only.
+ */
+#if defined(DUK__EXEC_CGOTO)
+#if defined(DUK_USE_GCC_PRAGMAS)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#elif defined(DUK_USE_CLANG_PRAGMAS)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpedantic"
+#endif
+#endif
+
 /* Inner executor, performance critical. */
 DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *entry_thread, duk_activation *entry_act) {
 	/* Current PC, accessed by other functions through thr->ptr_to_curr_pc.
@@ -3054,6 +3126,76 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 	duk_size_t valstack_top_base;    /* valstack top, should match before interpreting each op (no leftovers) */
 #endif
 
+#if defined(DUK__EXEC_CGOTO)
+	/* Handler label for each opcode, must match duk_js_bytecode.h. */
+	static const void * const duk__exec_dispatch[256] = {
+		/*   0 */ &&duk__op_LDREG, &&duk__op_STREG, &&duk__op_JUMP, &&duk__op_LDCONST,
+		/*   4 */ &&duk__op_LDINT, &&duk__op_LDINTX, &&duk__op_LDTHIS, &&duk__op_LDUNDEF,
+		/*   8 */ &&duk__op_LDNULL, &&duk__op_LDTRUE, &&duk__op_LDFALSE, &&duk__op_GETVAR,
+		/*  12 */ &&duk__op_BNOT, &&duk__op_LNOT, &&duk__op_UNM, &&duk__op_UNP,
+		/*  16 */ &&duk__op_EQ_RR, &&duk__op_EQ_CR, &&duk__op_EQ_RC, &&duk__op_EQ_CC,
+		/*  20 */ &&duk__op_NEQ_RR, &&duk__op_NEQ_CR, &&duk__op_NEQ_RC, &&duk__op_NEQ_CC,
+		/*  24 */ &&duk__op_SEQ_RR, &&duk__op_SEQ_CR, &&duk__op_SEQ_RC, &&duk__op_SEQ_CC,
+		/*  28 */ &&duk__op_SNEQ_RR, &&duk__op_SNEQ_CR, &&duk__op_SNEQ_RC, &&duk__op_SNEQ_CC,
+		/*  32 */ &&duk__op_GT_RR, &&duk__op_GT_CR, &&duk__op_GT_RC, &&duk__op_GT_CC,
+		/*  36 */ &&duk__op_GE_RR, &&duk__op_GE_CR, &&duk__op_GE_RC, &&duk__op_GE_CC,
+		/*  40 */ &&duk__op_LT_RR, &&duk__op_LT_CR, &&duk__op_LT_RC, &&duk__op_LT_CC,
+		/*  44 */ &&duk__op_LE_RR, &&duk__op_LE_CR, &&duk__op_LE_RC, &&duk__op_LE_CC,
+		/*  48 */ &&duk__op_IFTRUE_R, &&duk__op_IFTRUE_C, &&duk__op_IFFALSE_R, &&duk__op_IFFALSE_C,
+		/*  52 */ &&duk__op_ADD_RR, &&duk__op_ADD_CR, &&duk__op_ADD_RC, &&duk__op_ADD_CC,
+		/*  56 */ &&duk__op_SUB_RR, &&duk__op_SUB_CR, &&duk__op_SUB_RC, &&duk__op_SUB_CC,
+		/*  60 */ &&duk__op_MUL_RR, &&duk__op_MUL_CR, &&duk__op_MUL_RC, &&duk__op_MUL_CC,
+		/*  64 */ &&duk__op_DIV_RR, &&duk__op_DIV_CR, &&duk__op_DIV_RC, &&duk__op_DIV_CC,
+		/*  68 */ &&duk__op_MOD_RR, &&duk__op_MOD_CR, &&duk__op_MOD_RC, &&duk__op_MOD_CC,
+		/*  72 */ &&duk__op_EXP_RR, &&duk__op_EXP_CR, &&duk__op_EXP_RC, &&duk__op_EXP_CC,
+		/*  76 */ &&duk__op_BAND_RR, &&duk__op_BAND_CR, &&duk__op_BAND_RC, &&duk__op_BAND_CC,
+		/*  80 */ &&duk__op_BOR_RR, &&duk__op_BOR_CR, &&duk__op_BOR_RC, &&duk__op_BOR_CC,
+		/*  84 */ &&duk__op_BXOR_RR, &&duk__op_BXOR_CR, &&duk__op_BXOR_RC, &&duk__op_BXOR_CC,
+		/*  88 */ &&duk__op_BASL_RR, &&duk__op_BASL_CR, &&duk__op_BASL_RC, &&duk__op_BASL_CC,
+		/*  92 */ &&duk__op_BLSR_RR, &&duk__op_BLSR_CR, &&duk__op_BLSR_RC, &&duk__op_BLSR_CC,
+		/*  96 */ &&duk__op_BASR_RR, &&duk__op_BASR_CR, &&duk__op_BASR_RC, &&duk__op_BASR_CC,
+		/* 100 */ &&duk__op_INSTOF_RR, &&duk__op_INSTOF_CR, &&duk__op_INSTOF_RC, &&duk__op_INSTOF_CC,
+		/* 104 */ &&duk__op_IN_RR, &&duk__op_IN_CR, &&duk__op_IN_RC, &&duk__op_IN_CC,
+		/* 108 */ &&duk__op_GETPROP_RR, &&duk__op_GETPROP_CR, &&duk__op_GETPROP_RC, &&duk__op_GETPROP_CC,
+		/* 112 */ &&duk__op_PUTPROP_RR, &&duk__op_PUTPROP_CR, &&duk__op_PUTPROP_RC, &&duk__op_PUTPROP_CC,
+		/* 116 */ &&duk__op_DELPROP_RR, &&duk__op_default, &&duk__op_DELPROP_RC, &&duk__op_default,
+		/* 120 */ &&duk__op_PREINCR, &&duk__op_PREDECR, &&duk__op_POSTINCR, &&duk__op_POSTDECR,
+		/* 124 */ &&duk__op_PREINCV, &&duk__op_PREDECV, &&duk__op_POSTINCV, &&duk__op_POSTDECV,
+		/* 128 */ &&duk__op_PREINCP_RR, &&duk__op_PREINCP_CR, &&duk__op_PREINCP_RC, &&duk__op_PREINCP_CC,
+		/* 132 */ &&duk__op_PREDECP_RR, &&duk__op_PREDECP_CR, &&duk__op_PREDECP_RC, &&duk__op_PREDECP_CC,
+		/* 136 */ &&duk__op_POSTINCP_RR, &&duk__op_POSTINCP_CR, &&duk__op_POSTINCP_RC, &&duk__op_POSTINCP_CC,
+		/* 140 */ &&duk__op_POSTDECP_RR, &&duk__op_POSTDECP_CR, &&duk__op_POSTDECP_RC, &&duk__op_POSTDECP_CC,
+		/* 144 */ &&duk__op_DECLVAR_RR, &&duk__op_DECLVAR_CR, &&duk__op_DECLVAR_RC, &&duk__op_DECLVAR_CC,
+		/* 148 */ &&duk__op_REGEXP_RR, &&duk__op_REGEXP_CR, &&duk__op_REGEXP_RC, &&duk__op_REGEXP_CC,
+		/* 152 */ &&duk__op_CLOSURE, &&duk__op_TYPEOF, &&duk__op_TYPEOFID, &&duk__op_PUTVAR,
+		/* 156 */ &&duk__op_DELVAR, &&duk__op_RETREG, &&duk__op_RETUNDEF, &&duk__op_RETCONST,
+		/* 160 */ &&duk__op_RETCONSTN, &&duk__op_LABEL, &&duk__op_ENDLABEL, &&duk__op_BREAK,
+		/* 164 */ &&duk__op_CONTINUE, &&duk__op_TRYCATCH, &&duk__op_ENDTRY, &&duk__op_ENDCATCH,
+		/* 168 */ &&duk__op_ENDFIN, &&duk__op_THROW, &&duk__op_INVLHS, &&duk__op_CSREG,
+		/* 172 */ &&duk__op_CSVAR_RR, &&duk__op_CSVAR_CR, &&duk__op_CSVAR_RC, &&duk__op_CSVAR_CC,
+		/* 176 */ &&duk__op_CALL0, &&duk__op_CALL1, &&duk__op_CALL2, &&duk__op_CALL3,
+		/* 180 */ &&duk__op_CALL4, &&duk__op_CALL5, &&duk__op_CALL6, &&duk__op_CALL7,
+		/* 184 */ &&duk__op_CALL8, &&duk__op_CALL9, &&duk__op_CALL10, &&duk__op_CALL11,
+		/* 188 */ &&duk__op_CALL12, &&duk__op_CALL13, &&duk__op_CALL14, &&duk__op_CALL15,
+		/* 192 */ &&duk__op_NEWOBJ, &&duk__op_NEWARR, &&duk__op_MPUTOBJ, &&duk__op_MPUTOBJI,
+		/* 196 */ &&duk__op_INITSET, &&duk__op_INITGET, &&duk__op_MPUTARR, &&duk__op_MPUTARRI,
+		/* 200 */ &&duk__op_SETALEN, &&duk__op_INITENUM, &&duk__op_NEXTENUM, &&duk__op_NEWTARGET,
+		/* 204 */ &&duk__op_DEBUGGER, &&duk__op_NOP, &&duk__op_INVALID, &&duk__op_UNUSED207,
+		/* 208 */ &&duk__op_GETPROPC_RR, &&duk__op_GETPROPC_CR, &&duk__op_GETPROPC_RC, &&duk__op_GETPROPC_CC,
+		/* 212 */ &&duk__op_ADDTMP_RR, &&duk__op_ADDTMP_CR, &&duk__op_ADDTMP_RC, &&duk__op_ADDTMP_CC,
+		/* 216 */ &&duk__op_UNUSED216, &&duk__op_UNUSED217, &&duk__op_UNUSED218, &&duk__op_UNUSED219,
+		/* 220 */ &&duk__op_UNUSED220, &&duk__op_UNUSED221, &&duk__op_UNUSED222, &&duk__op_UNUSED223,
+		/* 224 */ &&duk__op_UNUSED224, &&duk__op_UNUSED225, &&duk__op_UNUSED226, &&duk__op_UNUSED227,
+		/* 228 */ &&duk__op_UNUSED228, &&duk__op_UNUSED229, &&duk__op_UNUSED230, &&duk__op_UNUSED231,
+		/* 232 */ &&duk__op_UNUSED232, &&duk__op_UNUSED233, &&duk__op_UNUSED234, &&duk__op_UNUSED235,
+		/* 236 */ &&duk__op_UNUSED236, &&duk__op_UNUSED237, &&duk__op_UNUSED238, &&duk__op_UNUSED239,
+		/* 240 */ &&duk__op_UNUSED240, &&duk__op_UNUSED241, &&duk__op_UNUSED242, &&duk__op_UNUSED243,
+		/* 244 */ &&duk__op_UNUSED244, &&duk__op_UNUSED245, &&duk__op_UNUSED246, &&duk__op_UNUSED247,
+		/* 248 */ &&duk__op_UNUSED248, &&duk__op_UNUSED249, &&duk__op_UNUSED250, &&duk__op_UNUSED251,
+		/* 252 */ &&duk__op_UNUSED252, &&duk__op_UNUSED253, &&duk__op_UNUSED254, &&duk__op_UNUSED255
+	};
+#endif
+
 	/* Optimized reg/const access macros assume sizeof(duk_tval) to be
 	 * either 8 or 16.  Heap allocation checks this even without asserts
 	 * enabled now because it can't be autodetected in duk_config.h.
@@ -3283,11 +3425,43 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		 * will (at least usually) omit a bounds check.
 		 */
 		op = (duk_uint8_t) DUK_DEC_OP(ins);
+#if defined(DUK__EXEC_CGOTO)
+		goto *duk__exec_dispatch[op];
+#endif
 		switch (op) {
 
 		/* Some useful macros.  These access inner executor variables
 		 * directly so they only apply within the executor.
 		 */
+#if defined(DUK__EXEC_CGOTO) && !defined(DUK_USE_ASSERTIONS) && !defined(DUK_USE_DEBUG)
+		/* Dispatch the next opcode directly from the handler; mirrors the
+		 * dispatch loop prologue.  Break out to the loop when the interrupt
+		 * counter triggers.  Assert/debug builds always go through the loop
+		 * to get its checks.
+		 */
+#if defined(DUK_USE_INTERRUPT_COUNTER)
+#define DUK__DISPATCH_BREAK() { \
+		int_ctr = thr->interrupt_counter; \
+		if (DUK_LIKELY(int_ctr > 0)) { \
+			thr->interrupt_counter = int_ctr - 1; \
+			ins = *curr_pc++; \
+			DUK_STATS_INC(thr->heap, stats_exec_opcodes); \
+			op = (duk_uint8_t) DUK_DEC_OP(ins); \
+			goto *duk__exec_dispatch[op]; \
+		} \
+		break; \
+	}
+#else  /* DUK_USE_INTERRUPT_COUNTER */
+#define DUK__DISPATCH_BREAK() { \
+		ins = *curr_pc++; \
+		DUK_STATS_INC(thr->heap, stats_exec_opcodes); \
+		op = (duk_uint8_t) DUK_DEC_OP(ins); \
+		goto *duk__exec_dispatch[op]; \
+	}
+#endif  /* DUK_USE_INTERRUPT_COUNTER */
+#else  /* DUK__EXEC_CGOTO */
+#define DUK__DISPATCH_BREAK() { break; }
+#endif  /* DUK__EXEC_CGOTO */
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
 #define DUK__REPLACE_TOP_A_BREAK() { goto replace_top_a; }
 #define DUK__REPLACE_TOP_BC_BREAK() { goto replace_top_bc; }
@@ -3299,8 +3473,8 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		DUK__REPLACE_TOP_A_BREAK(); \
 	}
 #else
-#define DUK__REPLACE_TOP_A_BREAK() { DUK__REPLACE_TO_TVPTR(thr, DUK__REGP_A(ins)); break; }
-#define DUK__REPLACE_TOP_BC_BREAK() { DUK__REPLACE_TO_TVPTR(thr, DUK__REGP_BC(ins)); break; }
+#define DUK__REPLACE_TOP_A_BREAK() { DUK__REPLACE_TO_TVPTR(thr, DUK__REGP_A(ins)); DUK__DISPATCH_BREAK(); }
+#define DUK__REPLACE_TOP_BC_BREAK() { DUK__REPLACE_TO_TVPTR(thr, DUK__REGP_BC(ins)); DUK__DISPATCH_BREAK(); }
 #define DUK__REPLACE_BOOL_A_BREAK(bval) { \
 		duk_bool_t duk__bval; \
 		duk_tval *duk__tvdst; \
@@ -3308,7 +3482,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		DUK_ASSERT(duk__bval == 0 || duk__bval == 1); \
 		duk__tvdst = DUK__REGP_A(ins); \
 		DUK_TVAL_SET_BOOLEAN_UPDREF(thr, duk__tvdst, duk__bval); \
-		break; \
+		DUK__DISPATCH_BREAK(); \
 	}
 #endif
 
@@ -3320,31 +3494,31 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		 * duk_dup() + duk_replace(), but because they're used quite a lot
 		 * they're currently intentionally not size optimized.
 		 */
-		case DUK_OP_LDREG: {
+		DUK__CASE(LDREG): {
 			duk_tval *tv1, *tv2;
 
 			tv1 = DUK__REGP_A(ins);
 			tv2 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_TVAL_UPDREF_FAST(thr, tv1, tv2);  /* side effects */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_STREG: {
+		DUK__CASE(STREG): {
 			duk_tval *tv1, *tv2;
 
 			tv1 = DUK__REGP_A(ins);
 			tv2 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_TVAL_UPDREF_FAST(thr, tv2, tv1);  /* side effects */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_LDCONST: {
+		DUK__CASE(LDCONST): {
 			duk_tval *tv1, *tv2;
 
 			tv1 = DUK__REGP_A(ins);
 			tv2 = DUK__CONSTP_BC(ins);
 			DUK_TVAL_SET_TVAL_UPDREF_FAST(thr, tv1, tv2);  /* side effects */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
 		/* LDINT and LDINTX are intended to load an arbitrary signed
@@ -3352,14 +3526,14 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		 * This also guarantees all values remain fastints.
 		 */
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_LDINT: {
+		DUK__CASE(LDINT): {
 			duk_int32_t val;
 
 			val = (duk_int32_t) DUK_DEC_BC(ins) - (duk_int32_t) DUK_BC_LDINT_BIAS;
 			duk_push_int(thr, val);
 			DUK__REPLACE_TOP_A_BREAK();
 		}
-		case DUK_OP_LDINTX: {
+		DUK__CASE(LDINTX): {
 			duk_int32_t val;
 
 			val = (duk_int32_t) duk_get_int(thr, DUK_DEC_A(ins));
@@ -3368,16 +3542,16 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK__REPLACE_TOP_A_BREAK();
 		}
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_LDINT: {
+		DUK__CASE(LDINT): {
 			duk_tval *tv1;
 			duk_int32_t val;
 
 			val = (duk_int32_t) DUK_DEC_BC(ins) - (duk_int32_t) DUK_BC_LDINT_BIAS;
 			tv1 = DUK__REGP_A(ins);
 			DUK_TVAL_SET_I32_UPDREF(thr, tv1, val);  /* side effects */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_LDINTX: {
+		DUK__CASE(LDINTX): {
 			duk_tval *tv1;
 			duk_int32_t val;
 
@@ -3392,33 +3566,33 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 #endif
 			val = (duk_int32_t) ((duk_uint32_t) val << DUK_BC_LDINTX_SHIFT) + (duk_int32_t) DUK_DEC_BC(ins);  /* no bias */
 			DUK_TVAL_SET_I32_UPDREF(thr, tv1, val);  /* side effects */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_LDTHIS: {
+		DUK__CASE(LDTHIS): {
 			duk_push_this(thr);
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
-		case DUK_OP_LDUNDEF: {
+		DUK__CASE(LDUNDEF): {
 			duk_to_undefined(thr, (duk_idx_t) DUK_DEC_BC(ins));
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_LDNULL: {
+		DUK__CASE(LDNULL): {
 			duk_to_null(thr, (duk_idx_t) DUK_DEC_BC(ins));
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_LDTRUE: {
+		DUK__CASE(LDTRUE): {
 			duk_push_true(thr);
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
-		case DUK_OP_LDFALSE: {
+		DUK__CASE(LDFALSE): {
 			duk_push_false(thr);
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_LDTHIS: {
+		DUK__CASE(LDTHIS): {
 			/* Note: 'this' may be bound to any value, not just an object */
 			duk_tval *tv1, *tv2;
 
@@ -3426,67 +3600,67 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			tv2 = thr->valstack_bottom - 1;  /* 'this binding' is just under bottom */
 			DUK_ASSERT(tv2 >= thr->valstack);
 			DUK_TVAL_SET_TVAL_UPDREF_FAST(thr, tv1, tv2);  /* side effects */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_LDUNDEF: {
+		DUK__CASE(LDUNDEF): {
 			duk_tval *tv1;
 
 			tv1 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_UNDEFINED_UPDREF(thr, tv1);  /* side effects */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_LDNULL: {
+		DUK__CASE(LDNULL): {
 			duk_tval *tv1;
 
 			tv1 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_NULL_UPDREF(thr, tv1);  /* side effects */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_LDTRUE: {
+		DUK__CASE(LDTRUE): {
 			duk_tval *tv1;
 
 			tv1 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_BOOLEAN_UPDREF(thr, tv1, 1);  /* side effects */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_LDFALSE: {
+		DUK__CASE(LDFALSE): {
 			duk_tval *tv1;
 
 			tv1 = DUK__REGP_BC(ins);
 			DUK_TVAL_SET_BOOLEAN_UPDREF(thr, tv1, 0);  /* side effects */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
-		case DUK_OP_BNOT: {
+		DUK__CASE(BNOT): {
 			duk__vm_bitwise_not(thr, DUK_DEC_BC(ins), DUK_DEC_A(ins));
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_LNOT: {
+		DUK__CASE(LNOT): {
 			duk__vm_logical_not(thr, DUK_DEC_BC(ins), DUK_DEC_A(ins));
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_UNM:
-		case DUK_OP_UNP: {
+		DUK__CASE(UNM):
+		DUK__CASE(UNP): {
 			duk__vm_arith_unary_op(thr, DUK_DEC_BC(ins), DUK_DEC_A(ins), op);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_UNM: {
+		DUK__CASE(UNM): {
 			duk__vm_arith_unary_op(thr, DUK_DEC_BC(ins), DUK_DEC_A(ins), DUK_OP_UNM);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_UNP: {
+		DUK__CASE(UNP): {
 			duk__vm_arith_unary_op(thr, DUK_DEC_BC(ins), DUK_DEC_A(ins), DUK_OP_UNP);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_TYPEOF: {
+		DUK__CASE(TYPEOF): {
 			duk_small_uint_t stridx;
 
 			stridx = duk_js_typeof_stridx(DUK__REGP_BC(ins));
@@ -3495,7 +3669,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK__REPLACE_TOP_A_BREAK();
 		}
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_TYPEOF: {
+		DUK__CASE(TYPEOF): {
 			duk_tval *tv;
 			duk_small_uint_t stridx;
 			duk_hstring *h_str;
@@ -3506,11 +3680,11 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			h_str = DUK_HTHREAD_GET_STRING(thr, stridx);
 			tv = DUK__REGP_A(ins);
 			DUK_TVAL_SET_STRING_UPDREF(thr, tv, h_str);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
-		case DUK_OP_TYPEOFID: {
+		DUK__CASE(TYPEOFID): {
 			duk_small_uint_t stridx;
 #if !defined(DUK_USE_EXEC_PREFER_SIZE)
 			duk_hstring *h_str;
@@ -3546,7 +3720,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			h_str = DUK_HTHREAD_GET_STRING(thr, stridx);
 			tv = DUK__REGP_A(ins);
 			DUK_TVAL_SET_STRING_UPDREF(thr, tv, h_str);
-			break;
+			DUK__DISPATCH_BREAK();
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 		}
 
@@ -3579,58 +3753,58 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		DUK__REPLACE_BOOL_A_BREAK(tmp); \
 	}
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_EQ_RR:
-		case DUK_OP_EQ_CR:
-		case DUK_OP_EQ_RC:
-		case DUK_OP_EQ_CC:
+		DUK__CASE(EQ_RR):
+		DUK__CASE(EQ_CR):
+		DUK__CASE(EQ_RC):
+		DUK__CASE(EQ_CC):
 			DUK__EQ_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_NEQ_RR:
-		case DUK_OP_NEQ_CR:
-		case DUK_OP_NEQ_RC:
-		case DUK_OP_NEQ_CC:
+		DUK__CASE(NEQ_RR):
+		DUK__CASE(NEQ_CR):
+		DUK__CASE(NEQ_RC):
+		DUK__CASE(NEQ_CC):
 			DUK__NEQ_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_SEQ_RR:
-		case DUK_OP_SEQ_CR:
-		case DUK_OP_SEQ_RC:
-		case DUK_OP_SEQ_CC:
+		DUK__CASE(SEQ_RR):
+		DUK__CASE(SEQ_CR):
+		DUK__CASE(SEQ_RC):
+		DUK__CASE(SEQ_CC):
 			DUK__SEQ_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_SNEQ_RR:
-		case DUK_OP_SNEQ_CR:
-		case DUK_OP_SNEQ_RC:
-		case DUK_OP_SNEQ_CC:
+		DUK__CASE(SNEQ_RR):
+		DUK__CASE(SNEQ_CR):
+		DUK__CASE(SNEQ_RC):
+		DUK__CASE(SNEQ_CC):
 			DUK__SNEQ_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_EQ_RR:
+		DUK__CASE(EQ_RR):
 			DUK__EQ_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_EQ_CR:
+		DUK__CASE(EQ_CR):
 			DUK__EQ_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_EQ_RC:
+		DUK__CASE(EQ_RC):
 			DUK__EQ_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_EQ_CC:
+		DUK__CASE(EQ_CC):
 			DUK__EQ_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_NEQ_RR:
+		DUK__CASE(NEQ_RR):
 			DUK__NEQ_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_NEQ_CR:
+		DUK__CASE(NEQ_CR):
 			DUK__NEQ_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_NEQ_RC:
+		DUK__CASE(NEQ_RC):
 			DUK__NEQ_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_NEQ_CC:
+		DUK__CASE(NEQ_CC):
 			DUK__NEQ_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_SEQ_RR:
+		DUK__CASE(SEQ_RR):
 			DUK__SEQ_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_SEQ_CR:
+		DUK__CASE(SEQ_CR):
 			DUK__SEQ_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_SEQ_RC:
+		DUK__CASE(SEQ_RC):
 			DUK__SEQ_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_SEQ_CC:
+		DUK__CASE(SEQ_CC):
 			DUK__SEQ_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_SNEQ_RR:
+		DUK__CASE(SNEQ_RR):
 			DUK__SNEQ_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_SNEQ_CR:
+		DUK__CASE(SNEQ_CR):
 			DUK__SNEQ_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_SNEQ_RC:
+		DUK__CASE(SNEQ_RC):
 			DUK__SNEQ_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_SNEQ_CC:
+		DUK__CASE(SNEQ_CC):
 			DUK__SNEQ_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
@@ -3645,353 +3819,362 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 #define DUK__LT_BODY(barg,carg) DUK__COMPARE_BODY((barg), (carg), DUK_COMPARE_FLAG_EVAL_LEFT_FIRST)
 #define DUK__LE_BODY(barg,carg) DUK__COMPARE_BODY((carg), (barg), DUK_COMPARE_FLAG_NEGATE)
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_GT_RR:
-		case DUK_OP_GT_CR:
-		case DUK_OP_GT_RC:
-		case DUK_OP_GT_CC:
+		DUK__CASE(GT_RR):
+		DUK__CASE(GT_CR):
+		DUK__CASE(GT_RC):
+		DUK__CASE(GT_CC):
 			DUK__GT_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_GE_RR:
-		case DUK_OP_GE_CR:
-		case DUK_OP_GE_RC:
-		case DUK_OP_GE_CC:
+		DUK__CASE(GE_RR):
+		DUK__CASE(GE_CR):
+		DUK__CASE(GE_RC):
+		DUK__CASE(GE_CC):
 			DUK__GE_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_LT_RR:
-		case DUK_OP_LT_CR:
-		case DUK_OP_LT_RC:
-		case DUK_OP_LT_CC:
+		DUK__CASE(LT_RR):
+		DUK__CASE(LT_CR):
+		DUK__CASE(LT_RC):
+		DUK__CASE(LT_CC):
 			DUK__LT_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_LE_RR:
-		case DUK_OP_LE_CR:
-		case DUK_OP_LE_RC:
-		case DUK_OP_LE_CC:
+		DUK__CASE(LE_RR):
+		DUK__CASE(LE_CR):
+		DUK__CASE(LE_RC):
+		DUK__CASE(LE_CC):
 			DUK__LE_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_GT_RR:
+		DUK__CASE(GT_RR):
 			DUK__GT_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GT_CR:
+		DUK__CASE(GT_CR):
 			DUK__GT_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GT_RC:
+		DUK__CASE(GT_RC):
 			DUK__GT_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_GT_CC:
+		DUK__CASE(GT_CC):
 			DUK__GT_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_GE_RR:
+		DUK__CASE(GE_RR):
 			DUK__GE_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GE_CR:
+		DUK__CASE(GE_CR):
 			DUK__GE_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GE_RC:
+		DUK__CASE(GE_RC):
 			DUK__GE_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_GE_CC:
+		DUK__CASE(GE_CC):
 			DUK__GE_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_LT_RR:
+		DUK__CASE(LT_RR):
 			DUK__LT_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_LT_CR:
+		DUK__CASE(LT_CR):
 			DUK__LT_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_LT_RC:
+		DUK__CASE(LT_RC):
 			DUK__LT_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_LT_CC:
+		DUK__CASE(LT_CC):
 			DUK__LT_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_LE_RR:
+		DUK__CASE(LE_RR):
 			DUK__LE_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_LE_CR:
+		DUK__CASE(LE_CR):
 			DUK__LE_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_LE_RC:
+		DUK__CASE(LE_RC):
 			DUK__LE_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_LE_CC:
+		DUK__CASE(LE_CC):
 			DUK__LE_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
 		/* No size optimized variant at present for IF. */
-		case DUK_OP_IFTRUE_R: {
+		DUK__CASE(IFTRUE_R): {
 			if (duk_js_toboolean(DUK__REGP_BC(ins)) != 0) {
 				curr_pc++;
 			}
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_IFTRUE_C: {
+		DUK__CASE(IFTRUE_C): {
 			if (duk_js_toboolean(DUK__CONSTP_BC(ins)) != 0) {
 				curr_pc++;
 			}
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_IFFALSE_R: {
+		DUK__CASE(IFFALSE_R): {
 			if (duk_js_toboolean(DUK__REGP_BC(ins)) == 0) {
 				curr_pc++;
 			}
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_IFFALSE_C: {
+		DUK__CASE(IFFALSE_C): {
 			if (duk_js_toboolean(DUK__CONSTP_BC(ins)) == 0) {
 				curr_pc++;
 			}
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_ADD_RR:
-		case DUK_OP_ADD_CR:
-		case DUK_OP_ADD_RC:
-		case DUK_OP_ADD_CC: {
+		DUK__CASE(ADD_RR):
+		DUK__CASE(ADD_CR):
+		DUK__CASE(ADD_RC):
+		DUK__CASE(ADD_CC): {
 			/* XXX: could leave value on stack top and goto replace_top_a; */
 			duk__vm_arith_add(thr, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins), DUK_DEC_A(ins));
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_ADD_RR: {
+		DUK__CASE(ADD_RR): {
 			duk__vm_arith_add(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins));
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_ADD_CR: {
+		DUK__CASE(ADD_CR): {
 			duk__vm_arith_add(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins));
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_ADD_RC: {
+		DUK__CASE(ADD_RC): {
 			duk__vm_arith_add(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins));
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_ADD_CC: {
+		DUK__CASE(ADD_CC): {
 			duk__vm_arith_add(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins));
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
+		/* B is always a temporary register in practice. */
+		DUK__CASE(ADDTMP_RR):
+		DUK__CASE(ADDTMP_CR):
+		DUK__CASE(ADDTMP_RC):
+		DUK__CASE(ADDTMP_CC): {
+			duk__vm_arith_addtmp(thr, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins), DUK_DEC_A(ins));
+			DUK__DISPATCH_BREAK();
+		}
+
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_SUB_RR:
-		case DUK_OP_SUB_CR:
-		case DUK_OP_SUB_RC:
-		case DUK_OP_SUB_CC:
-		case DUK_OP_MUL_RR:
-		case DUK_OP_MUL_CR:
-		case DUK_OP_MUL_RC:
-		case DUK_OP_MUL_CC:
-		case DUK_OP_DIV_RR:
-		case DUK_OP_DIV_CR:
-		case DUK_OP_DIV_RC:
-		case DUK_OP_DIV_CC:
-		case DUK_OP_MOD_RR:
-		case DUK_OP_MOD_CR:
-		case DUK_OP_MOD_RC:
-		case DUK_OP_MOD_CC:
+		DUK__CASE(SUB_RR):
+		DUK__CASE(SUB_CR):
+		DUK__CASE(SUB_RC):
+		DUK__CASE(SUB_CC):
+		DUK__CASE(MUL_RR):
+		DUK__CASE(MUL_CR):
+		DUK__CASE(MUL_RC):
+		DUK__CASE(MUL_CC):
+		DUK__CASE(DIV_RR):
+		DUK__CASE(DIV_CR):
+		DUK__CASE(DIV_RC):
+		DUK__CASE(DIV_CC):
+		DUK__CASE(MOD_RR):
+		DUK__CASE(MOD_CR):
+		DUK__CASE(MOD_RC):
+		DUK__CASE(MOD_CC):
 #if defined(DUK_USE_ES7_EXP_OPERATOR)
-		case DUK_OP_EXP_RR:
-		case DUK_OP_EXP_CR:
-		case DUK_OP_EXP_RC:
-		case DUK_OP_EXP_CC:
+		DUK__CASE(EXP_RR):
+		DUK__CASE(EXP_CR):
+		DUK__CASE(EXP_RC):
+		DUK__CASE(EXP_CC):
 #endif  /* DUK_USE_ES7_EXP_OPERATOR */
 		{
 			/* XXX: could leave value on stack top and goto replace_top_a; */
 			duk__vm_arith_binary_op(thr, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins), DUK_DEC_A(ins), op);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_SUB_RR: {
+		DUK__CASE(SUB_RR): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_SUB);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_SUB_CR: {
+		DUK__CASE(SUB_CR): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_SUB);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_SUB_RC: {
+		DUK__CASE(SUB_RC): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_SUB);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_SUB_CC: {
+		DUK__CASE(SUB_CC): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_SUB);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_MUL_RR: {
+		DUK__CASE(MUL_RR): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_MUL);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_MUL_CR: {
+		DUK__CASE(MUL_CR): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_MUL);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_MUL_RC: {
+		DUK__CASE(MUL_RC): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_MUL);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_MUL_CC: {
+		DUK__CASE(MUL_CC): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_MUL);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_DIV_RR: {
+		DUK__CASE(DIV_RR): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_DIV);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_DIV_CR: {
+		DUK__CASE(DIV_CR): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_DIV);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_DIV_RC: {
+		DUK__CASE(DIV_RC): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_DIV);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_DIV_CC: {
+		DUK__CASE(DIV_CC): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_DIV);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_MOD_RR: {
+		DUK__CASE(MOD_RR): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_MOD);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_MOD_CR: {
+		DUK__CASE(MOD_CR): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_MOD);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_MOD_RC: {
+		DUK__CASE(MOD_RC): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_MOD);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_MOD_CC: {
+		DUK__CASE(MOD_CC): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_MOD);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #if defined(DUK_USE_ES7_EXP_OPERATOR)
-		case DUK_OP_EXP_RR: {
+		DUK__CASE(EXP_RR): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_EXP);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_EXP_CR: {
+		DUK__CASE(EXP_CR): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_EXP);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_EXP_RC: {
+		DUK__CASE(EXP_RC): {
 			duk__vm_arith_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_EXP);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_EXP_CC: {
+		DUK__CASE(EXP_CC): {
 			duk__vm_arith_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_EXP);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #endif  /* DUK_USE_ES7_EXP_OPERATOR */
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_BAND_RR:
-		case DUK_OP_BAND_CR:
-		case DUK_OP_BAND_RC:
-		case DUK_OP_BAND_CC:
-		case DUK_OP_BOR_RR:
-		case DUK_OP_BOR_CR:
-		case DUK_OP_BOR_RC:
-		case DUK_OP_BOR_CC:
-		case DUK_OP_BXOR_RR:
-		case DUK_OP_BXOR_CR:
-		case DUK_OP_BXOR_RC:
-		case DUK_OP_BXOR_CC:
-		case DUK_OP_BASL_RR:
-		case DUK_OP_BASL_CR:
-		case DUK_OP_BASL_RC:
-		case DUK_OP_BASL_CC:
-		case DUK_OP_BLSR_RR:
-		case DUK_OP_BLSR_CR:
-		case DUK_OP_BLSR_RC:
-		case DUK_OP_BLSR_CC:
-		case DUK_OP_BASR_RR:
-		case DUK_OP_BASR_CR:
-		case DUK_OP_BASR_RC:
-		case DUK_OP_BASR_CC: {
+		DUK__CASE(BAND_RR):
+		DUK__CASE(BAND_CR):
+		DUK__CASE(BAND_RC):
+		DUK__CASE(BAND_CC):
+		DUK__CASE(BOR_RR):
+		DUK__CASE(BOR_CR):
+		DUK__CASE(BOR_RC):
+		DUK__CASE(BOR_CC):
+		DUK__CASE(BXOR_RR):
+		DUK__CASE(BXOR_CR):
+		DUK__CASE(BXOR_RC):
+		DUK__CASE(BXOR_CC):
+		DUK__CASE(BASL_RR):
+		DUK__CASE(BASL_CR):
+		DUK__CASE(BASL_RC):
+		DUK__CASE(BASL_CC):
+		DUK__CASE(BLSR_RR):
+		DUK__CASE(BLSR_CR):
+		DUK__CASE(BLSR_RC):
+		DUK__CASE(BLSR_CC):
+		DUK__CASE(BASR_RR):
+		DUK__CASE(BASR_CR):
+		DUK__CASE(BASR_RC):
+		DUK__CASE(BASR_CC): {
 			/* XXX: could leave value on stack top and goto replace_top_a; */
 			duk__vm_bitwise_binary_op(thr, DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins), DUK_DEC_A(ins), op);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_BAND_RR: {
+		DUK__CASE(BAND_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BAND);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BAND_CR: {
+		DUK__CASE(BAND_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BAND);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BAND_RC: {
+		DUK__CASE(BAND_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BAND);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BAND_CC: {
+		DUK__CASE(BAND_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BAND);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BOR_RR: {
+		DUK__CASE(BOR_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BOR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BOR_CR: {
+		DUK__CASE(BOR_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BOR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BOR_RC: {
+		DUK__CASE(BOR_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BOR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BOR_CC: {
+		DUK__CASE(BOR_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BOR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BXOR_RR: {
+		DUK__CASE(BXOR_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BXOR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BXOR_CR: {
+		DUK__CASE(BXOR_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BXOR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BXOR_RC: {
+		DUK__CASE(BXOR_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BXOR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BXOR_CC: {
+		DUK__CASE(BXOR_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BXOR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BASL_RR: {
+		DUK__CASE(BASL_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BASL);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BASL_CR: {
+		DUK__CASE(BASL_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BASL);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BASL_RC: {
+		DUK__CASE(BASL_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BASL);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BASL_CC: {
+		DUK__CASE(BASL_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BASL);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BLSR_RR: {
+		DUK__CASE(BLSR_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BLSR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BLSR_CR: {
+		DUK__CASE(BLSR_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BLSR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BLSR_RC: {
+		DUK__CASE(BLSR_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BLSR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BLSR_CC: {
+		DUK__CASE(BLSR_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BLSR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BASR_RR: {
+		DUK__CASE(BASR_RR): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BASR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BASR_CR: {
+		DUK__CASE(BASR_CR): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__REGP_C(ins), DUK_DEC_A(ins), DUK_OP_BASR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BASR_RC: {
+		DUK__CASE(BASR_RC): {
 			duk__vm_bitwise_binary_op(thr, DUK__REGP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BASR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_BASR_CC: {
+		DUK__CASE(BASR_CC): {
 			duk__vm_bitwise_binary_op(thr, DUK__CONSTP_B(ins), DUK__CONSTP_C(ins), DUK_DEC_A(ins), DUK_OP_BASR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
@@ -4009,104 +4192,104 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		DUK__REPLACE_BOOL_A_BREAK(tmp); \
 	}
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_INSTOF_RR:
-		case DUK_OP_INSTOF_CR:
-		case DUK_OP_INSTOF_RC:
-		case DUK_OP_INSTOF_CC:
+		DUK__CASE(INSTOF_RR):
+		DUK__CASE(INSTOF_CR):
+		DUK__CASE(INSTOF_RC):
+		DUK__CASE(INSTOF_CC):
 			DUK__INSTOF_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_IN_RR:
-		case DUK_OP_IN_CR:
-		case DUK_OP_IN_RC:
-		case DUK_OP_IN_CC:
+		DUK__CASE(IN_RR):
+		DUK__CASE(IN_CR):
+		DUK__CASE(IN_RC):
+		DUK__CASE(IN_CC):
 			DUK__IN_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_INSTOF_RR:
+		DUK__CASE(INSTOF_RR):
 			DUK__INSTOF_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_INSTOF_CR:
+		DUK__CASE(INSTOF_CR):
 			DUK__INSTOF_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_INSTOF_RC:
+		DUK__CASE(INSTOF_RC):
 			DUK__INSTOF_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_INSTOF_CC:
+		DUK__CASE(INSTOF_CC):
 			DUK__INSTOF_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_IN_RR:
+		DUK__CASE(IN_RR):
 			DUK__IN_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_IN_CR:
+		DUK__CASE(IN_CR):
 			DUK__IN_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_IN_RC:
+		DUK__CASE(IN_RC):
 			DUK__IN_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_IN_CC:
+		DUK__CASE(IN_CC):
 			DUK__IN_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
 		/* Pre/post inc/dec for register variables, important for loops. */
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_PREINCR:
-		case DUK_OP_PREDECR:
-		case DUK_OP_POSTINCR:
-		case DUK_OP_POSTDECR: {
+		DUK__CASE(PREINCR):
+		DUK__CASE(PREDECR):
+		DUK__CASE(POSTINCR):
+		DUK__CASE(POSTDECR): {
 			duk__prepost_incdec_reg_helper(thr, DUK__REGP_A(ins), DUK__REGP_BC(ins), op);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_PREINCV:
-		case DUK_OP_PREDECV:
-		case DUK_OP_POSTINCV:
-		case DUK_OP_POSTDECV: {
+		DUK__CASE(PREINCV):
+		DUK__CASE(PREDECV):
+		DUK__CASE(POSTINCV):
+		DUK__CASE(POSTDECV): {
 			duk__prepost_incdec_var_helper(thr, DUK_DEC_A(ins), DUK__CONSTP_BC(ins), op, DUK__STRICT());
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_PREINCR: {
+		DUK__CASE(PREINCR): {
 			duk__prepost_incdec_reg_helper(thr, DUK__REGP_A(ins), DUK__REGP_BC(ins), DUK_OP_PREINCR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_PREDECR: {
+		DUK__CASE(PREDECR): {
 			duk__prepost_incdec_reg_helper(thr, DUK__REGP_A(ins), DUK__REGP_BC(ins), DUK_OP_PREDECR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_POSTINCR: {
+		DUK__CASE(POSTINCR): {
 			duk__prepost_incdec_reg_helper(thr, DUK__REGP_A(ins), DUK__REGP_BC(ins), DUK_OP_POSTINCR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_POSTDECR: {
+		DUK__CASE(POSTDECR): {
 			duk__prepost_incdec_reg_helper(thr, DUK__REGP_A(ins), DUK__REGP_BC(ins), DUK_OP_POSTDECR);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_PREINCV: {
+		DUK__CASE(PREINCV): {
 			duk__prepost_incdec_var_helper(thr, DUK_DEC_A(ins), DUK__CONSTP_BC(ins), DUK_OP_PREINCV, DUK__STRICT());
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_PREDECV: {
+		DUK__CASE(PREDECV): {
 			duk__prepost_incdec_var_helper(thr, DUK_DEC_A(ins), DUK__CONSTP_BC(ins), DUK_OP_PREDECV, DUK__STRICT());
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_POSTINCV: {
+		DUK__CASE(POSTINCV): {
 			duk__prepost_incdec_var_helper(thr, DUK_DEC_A(ins), DUK__CONSTP_BC(ins), DUK_OP_POSTINCV, DUK__STRICT());
-			break;
+			DUK__DISPATCH_BREAK();
 		}
-		case DUK_OP_POSTDECV: {
+		DUK__CASE(POSTDECV): {
 			duk__prepost_incdec_var_helper(thr, DUK_DEC_A(ins), DUK__CONSTP_BC(ins), DUK_OP_POSTDECV, DUK__STRICT());
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
 		/* XXX: Move to separate helper, optimize for perf/size separately. */
 		/* Preinc/predec for object properties. */
-		case DUK_OP_PREINCP_RR:
-		case DUK_OP_PREINCP_CR:
-		case DUK_OP_PREINCP_RC:
-		case DUK_OP_PREINCP_CC:
-		case DUK_OP_PREDECP_RR:
-		case DUK_OP_PREDECP_CR:
-		case DUK_OP_PREDECP_RC:
-		case DUK_OP_PREDECP_CC:
-		case DUK_OP_POSTINCP_RR:
-		case DUK_OP_POSTINCP_CR:
-		case DUK_OP_POSTINCP_RC:
-		case DUK_OP_POSTINCP_CC:
-		case DUK_OP_POSTDECP_RR:
-		case DUK_OP_POSTDECP_CR:
-		case DUK_OP_POSTDECP_RC:
-		case DUK_OP_POSTDECP_CC: {
+		DUK__CASE(PREINCP_RR):
+		DUK__CASE(PREINCP_CR):
+		DUK__CASE(PREINCP_RC):
+		DUK__CASE(PREINCP_CC):
+		DUK__CASE(PREDECP_RR):
+		DUK__CASE(PREDECP_CR):
+		DUK__CASE(PREDECP_RC):
+		DUK__CASE(PREDECP_CC):
+		DUK__CASE(POSTINCP_RR):
+		DUK__CASE(POSTINCP_CR):
+		DUK__CASE(POSTINCP_RC):
+		DUK__CASE(POSTINCP_CC):
+		DUK__CASE(POSTDECP_RR):
+		DUK__CASE(POSTDECP_CR):
+		DUK__CASE(POSTDECP_RC):
+		DUK__CASE(POSTDECP_CC): {
 			duk_tval *tv_obj;
 			duk_tval *tv_key;
 			duk_tval *tv_val;
@@ -4168,7 +4351,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 #else
 			tv_dst = DUK__REGP_A(ins);
 			DUK_TVAL_SET_NUMBER_UPDREF(thr, tv_dst, z);
-			break;
+			DUK__DISPATCH_BREAK();
 #endif
 		}
 
@@ -4208,7 +4391,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		 * of e.g. GETPROP; 'A' must contain a register-only value. \
 		 */ \
 		(void) duk_hobject_putprop(thr, (aarg), (barg), (carg), DUK__STRICT()); \
-		break; \
+		DUK__DISPATCH_BREAK(); \
 	}
 #define DUK__DELPROP_BODY(barg,carg) { \
 		/* A -> result reg \
@@ -4221,64 +4404,64 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		DUK__REPLACE_BOOL_A_BREAK(rc); \
 	}
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_GETPROP_RR:
-		case DUK_OP_GETPROP_CR:
-		case DUK_OP_GETPROP_RC:
-		case DUK_OP_GETPROP_CC:
+		DUK__CASE(GETPROP_RR):
+		DUK__CASE(GETPROP_CR):
+		DUK__CASE(GETPROP_RC):
+		DUK__CASE(GETPROP_CC):
 			DUK__GETPROP_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
 #if defined(DUK_USE_VERBOSE_ERRORS)
-		case DUK_OP_GETPROPC_RR:
-		case DUK_OP_GETPROPC_CR:
-		case DUK_OP_GETPROPC_RC:
-		case DUK_OP_GETPROPC_CC:
+		DUK__CASE(GETPROPC_RR):
+		DUK__CASE(GETPROPC_CR):
+		DUK__CASE(GETPROPC_RC):
+		DUK__CASE(GETPROPC_CC):
 			DUK__GETPROPC_BODY(DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
 #endif
-		case DUK_OP_PUTPROP_RR:
-		case DUK_OP_PUTPROP_CR:
-		case DUK_OP_PUTPROP_RC:
-		case DUK_OP_PUTPROP_CC:
+		DUK__CASE(PUTPROP_RR):
+		DUK__CASE(PUTPROP_CR):
+		DUK__CASE(PUTPROP_RC):
+		DUK__CASE(PUTPROP_CC):
 			DUK__PUTPROP_BODY(DUK__REGP_A(ins), DUK__REGCONSTP_B(ins), DUK__REGCONSTP_C(ins));
-		case DUK_OP_DELPROP_RR:
-		case DUK_OP_DELPROP_RC:  /* B is always reg */
+		DUK__CASE(DELPROP_RR):
+		DUK__CASE(DELPROP_RC):  /* B is always reg */
 			DUK__DELPROP_BODY(DUK__REGP_B(ins), DUK__REGCONSTP_C(ins));
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_GETPROP_RR:
+		DUK__CASE(GETPROP_RR):
 			DUK__GETPROP_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GETPROP_CR:
+		DUK__CASE(GETPROP_CR):
 			DUK__GETPROP_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GETPROP_RC:
+		DUK__CASE(GETPROP_RC):
 			DUK__GETPROP_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_GETPROP_CC:
+		DUK__CASE(GETPROP_CC):
 			DUK__GETPROP_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #if defined(DUK_USE_VERBOSE_ERRORS)
-		case DUK_OP_GETPROPC_RR:
+		DUK__CASE(GETPROPC_RR):
 			DUK__GETPROPC_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GETPROPC_CR:
+		DUK__CASE(GETPROPC_CR):
 			DUK__GETPROPC_BODY(DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_GETPROPC_RC:
+		DUK__CASE(GETPROPC_RC):
 			DUK__GETPROPC_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_GETPROPC_CC:
+		DUK__CASE(GETPROPC_CC):
 			DUK__GETPROPC_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif
-		case DUK_OP_PUTPROP_RR:
+		DUK__CASE(PUTPROP_RR):
 			DUK__PUTPROP_BODY(DUK__REGP_A(ins), DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_PUTPROP_CR:
+		DUK__CASE(PUTPROP_CR):
 			DUK__PUTPROP_BODY(DUK__REGP_A(ins), DUK__CONSTP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_PUTPROP_RC:
+		DUK__CASE(PUTPROP_RC):
 			DUK__PUTPROP_BODY(DUK__REGP_A(ins), DUK__REGP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_PUTPROP_CC:
+		DUK__CASE(PUTPROP_CC):
 			DUK__PUTPROP_BODY(DUK__REGP_A(ins), DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
-		case DUK_OP_DELPROP_RR:  /* B is always reg */
+		DUK__CASE(DELPROP_RR):  /* B is always reg */
 			DUK__DELPROP_BODY(DUK__REGP_B(ins), DUK__REGP_C(ins));
-		case DUK_OP_DELPROP_RC:
+		DUK__CASE(DELPROP_RC):
 			DUK__DELPROP_BODY(DUK__REGP_B(ins), DUK__CONSTP_C(ins));
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
 		/* No fast path for DECLVAR now, it's quite a rare instruction. */
-		case DUK_OP_DECLVAR_RR:
-		case DUK_OP_DECLVAR_CR:
-		case DUK_OP_DECLVAR_RC:
-		case DUK_OP_DECLVAR_CC: {
+		DUK__CASE(DECLVAR_RR):
+		DUK__CASE(DECLVAR_CR):
+		DUK__CASE(DECLVAR_RC):
+		DUK__CASE(DECLVAR_CC): {
 			duk_activation *act;
 			duk_small_uint_fast_t a = DUK_DEC_A(ins);
 			duk_tval *tv1;
@@ -4324,17 +4507,17 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			}
 
 			duk_pop_unsafe(thr);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
 #if defined(DUK_USE_REGEXP_SUPPORT)
 		/* The compiler should never emit DUK_OP_REGEXP if there is no
 		 * regexp support.
 		 */
-		case DUK_OP_REGEXP_RR:
-		case DUK_OP_REGEXP_CR:
-		case DUK_OP_REGEXP_RC:
-		case DUK_OP_REGEXP_CC: {
+		DUK__CASE(REGEXP_RR):
+		DUK__CASE(REGEXP_CR):
+		DUK__CASE(REGEXP_RC):
+		DUK__CASE(REGEXP_CC): {
 			/* A -> target register
 			 * B -> bytecode (also contains flags)
 			 * C -> escaped source
@@ -4348,10 +4531,10 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 #endif  /* DUK_USE_REGEXP_SUPPORT */
 
 		/* XXX: 'c' is unused, use whole BC, etc. */
-		case DUK_OP_CSVAR_RR:
-		case DUK_OP_CSVAR_CR:
-		case DUK_OP_CSVAR_RC:
-		case DUK_OP_CSVAR_CC: {
+		DUK__CASE(CSVAR_RR):
+		DUK__CASE(CSVAR_CR):
+		DUK__CASE(CSVAR_RC):
+		DUK__CASE(CSVAR_CC): {
 			/* The speciality of calling through a variable binding is that the
 			 * 'this' value may be provided by the variable lookup: E5 Section 6.b.i.
 			 *
@@ -4381,10 +4564,10 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			/* Could add direct value stack handling. */
 			duk_replace(thr, (duk_idx_t) (idx + 1));  /* 'this' binding */
 			duk_replace(thr, (duk_idx_t) idx);        /* variable value (function, we hope, not checked here) */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_CLOSURE: {
+		DUK__CASE(CLOSURE): {
 			duk_activation *act;
 			duk_hcompfunc *fun_act;
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
@@ -4429,7 +4612,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK__REPLACE_TOP_A_BREAK();
 		}
 
-		case DUK_OP_GETVAR: {
+		DUK__CASE(GETVAR): {
 			duk_activation *act;
 			duk_tval *tv1;
 			duk_hstring *name;
@@ -4445,7 +4628,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK__REPLACE_TOP_A_BREAK();
 		}
 
-		case DUK_OP_PUTVAR: {
+		DUK__CASE(PUTVAR): {
 			duk_activation *act;
 			duk_tval *tv1;
 			duk_hstring *name;
@@ -4462,10 +4645,10 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			tv1 = DUK__REGP_A(ins);  /* val */
 			act = thr->callstack_curr;
 			duk_js_putvar_activation(thr, act, name, tv1, DUK__STRICT());
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_DELVAR: {
+		DUK__CASE(DELVAR): {
 			duk_activation *act;
 			duk_tval *tv1;
 			duk_hstring *name;
@@ -4480,13 +4663,13 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK__REPLACE_BOOL_A_BREAK(rc);
 		}
 
-		case DUK_OP_JUMP: {
+		DUK__CASE(JUMP): {
 			/* Note: without explicit cast to signed, MSVC will
 			 * apparently generate a large positive jump when the
 			 * bias-corrected value would normally be negative.
 			 */
 			curr_pc += (duk_int_fast_t) DUK_DEC_ABC(ins) - (duk_int_fast_t) DUK_BC_JUMP_BIAS;
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
 #define DUK__RETURN_SHARED() do { \
@@ -4504,10 +4687,10 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		return; \
 	} while (0)
 #if defined(DUK_USE_EXEC_PREFER_SIZE)
-		case DUK_OP_RETREG:
-		case DUK_OP_RETCONST:
-		case DUK_OP_RETCONSTN:
-		case DUK_OP_RETUNDEF: {
+		DUK__CASE(RETREG):
+		DUK__CASE(RETCONST):
+		DUK__CASE(RETCONSTN):
+		DUK__CASE(RETUNDEF): {
 			 /* BC -> return value reg/const */
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4525,7 +4708,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK__RETURN_SHARED();
 		}
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
-		case DUK_OP_RETREG: {
+		DUK__CASE(RETREG): {
 			duk_tval *tv;
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4536,7 +4719,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK__RETURN_SHARED();
 		}
 		/* This will be unused without refcounting. */
-		case DUK_OP_RETCONST: {
+		DUK__CASE(RETCONST): {
 			duk_tval *tv;
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4546,7 +4729,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			thr->valstack_top++;
 			DUK__RETURN_SHARED();
 		}
-		case DUK_OP_RETCONSTN: {
+		DUK__CASE(RETCONSTN): {
 			duk_tval *tv;
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4559,7 +4742,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			thr->valstack_top++;
 			DUK__RETURN_SHARED();
 		}
-		case DUK_OP_RETUNDEF: {
+		DUK__CASE(RETUNDEF): {
 			DUK__SYNC_AND_NULL_CURR_PC();
 			thr->valstack_top++;  /* value at valstack top is already undefined by valstack policy */
 			DUK_ASSERT(DUK_TVAL_IS_UNDEFINED(thr->valstack_top));
@@ -4567,7 +4750,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		}
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
 
-		case DUK_OP_LABEL: {
+		DUK__CASE(LABEL): {
 			duk_activation *act;
 			duk_catcher *cat;
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
@@ -4593,10 +4776,10 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			                     (long) cat->idx_base, (duk_heaphdr *) cat->h_varname, (long) DUK_CAT_GET_LABEL(cat)));
 
 			curr_pc += 2;  /* skip jump slots */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_ENDLABEL: {
+		DUK__CASE(ENDLABEL): {
 			duk_activation *act;
 #if (defined(DUK_USE_DEBUG_LEVEL) && (DUK_USE_DEBUG_LEVEL >= 2)) || defined(DUK_USE_ASSERTIONS)
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
@@ -4612,10 +4795,10 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			duk_hthread_catcher_unwind_nolexenv_norz(thr, act);
 
 			/* no need to unwind callstack */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_BREAK: {
+		DUK__CASE(BREAK): {
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4623,7 +4806,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			goto restart_execution;
 		}
 
-		case DUK_OP_CONTINUE: {
+		DUK__CASE(CONTINUE): {
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
 
 			DUK__SYNC_AND_NULL_CURR_PC();
@@ -4632,23 +4815,23 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		}
 
 		/* XXX: move to helper, too large to be inline here */
-		case DUK_OP_TRYCATCH: {
+		DUK__CASE(TRYCATCH): {
 			duk__handle_op_trycatch(thr, ins, curr_pc);
 			curr_pc += 2;  /* skip jump slots */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_ENDTRY: {
+		DUK__CASE(ENDTRY): {
 			curr_pc = duk__handle_op_endtry(thr, ins);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_ENDCATCH: {
+		DUK__CASE(ENDCATCH): {
 			duk__handle_op_endcatch(thr, ins);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_ENDFIN: {
+		DUK__CASE(ENDFIN): {
 			/* Sync and NULL early. */
 			DUK__SYNC_AND_NULL_CURR_PC();
 
@@ -4660,7 +4843,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			goto restart_execution;
 		}
 
-		case DUK_OP_THROW: {
+		DUK__CASE(THROW): {
 			duk_small_uint_fast_t bc = DUK_DEC_BC(ins);
 
 			/* Note: errors are augmented when they are created, not
@@ -4691,10 +4874,10 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK_ASSERT(thr->heap->lj.jmpbuf_ptr != NULL);  /* always in executor */
 			duk_err_longjmp(thr);
 			DUK_UNREACHABLE();
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_CSREG: {
+		DUK__CASE(CSREG): {
 			/*
 			 *  Assuming a register binds to a variable declared within this
 			 *  function (a declarative binding), the 'this' for the call
@@ -4730,7 +4913,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK_TVAL_DECREF(thr, &tv_tmp1);
 			DUK_TVAL_DECREF(thr, &tv_tmp2);
 #endif
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
 
@@ -4740,14 +4923,14 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		 * stack resize would be large).
 		 */
 
-		case DUK_OP_CALL0:
-		case DUK_OP_CALL1:
-		case DUK_OP_CALL2:
-		case DUK_OP_CALL3:
-		case DUK_OP_CALL4:
-		case DUK_OP_CALL5:
-		case DUK_OP_CALL6:
-		case DUK_OP_CALL7: {
+		DUK__CASE(CALL0):
+		DUK__CASE(CALL1):
+		DUK__CASE(CALL2):
+		DUK__CASE(CALL3):
+		DUK__CASE(CALL4):
+		DUK__CASE(CALL5):
+		DUK__CASE(CALL6):
+		DUK__CASE(CALL7): {
 			/* Opcode packs 4 flag bits: 1 for indirect, 3 map
 			 * 1:1 to three lowest call handling flags.
 			 *
@@ -4791,17 +4974,17 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			 * status after returning.  This is now handled by call handling
 			 * and heap->dbg_force_restart.
 			 */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_CALL8:
-		case DUK_OP_CALL9:
-		case DUK_OP_CALL10:
-		case DUK_OP_CALL11:
-		case DUK_OP_CALL12:
-		case DUK_OP_CALL13:
-		case DUK_OP_CALL14:
-		case DUK_OP_CALL15: {
+		DUK__CASE(CALL8):
+		DUK__CASE(CALL9):
+		DUK__CASE(CALL10):
+		DUK__CASE(CALL11):
+		DUK__CASE(CALL12):
+		DUK__CASE(CALL13):
+		DUK__CASE(CALL14):
+		DUK__CASE(CALL15): {
 			/* Indirect variant. */
 			duk_uint_fast_t nargs;
 			duk_idx_t idx;
@@ -4828,10 +5011,10 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			fun = DUK__FUN();
 #endif
 			duk_set_top_unsafe(thr, (duk_idx_t) fun->nregs);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_NEWOBJ: {
+		DUK__CASE(NEWOBJ): {
 			duk_push_object(thr);
 #if defined(DUK_USE_ASSERTIONS)
 			{
@@ -4850,7 +5033,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
 
-		case DUK_OP_NEWARR: {
+		DUK__CASE(NEWARR): {
 			duk_push_array(thr);
 #if defined(DUK_USE_ASSERTIONS)
 			{
@@ -4877,8 +5060,8 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
 
-		case DUK_OP_MPUTOBJ:
-		case DUK_OP_MPUTOBJI: {
+		DUK__CASE(MPUTOBJ):
+		DUK__CASE(MPUTOBJI): {
 			duk_idx_t obj_idx;
 			duk_uint_fast_t idx, idx_end;
 			duk_small_uint_fast_t count;
@@ -4930,17 +5113,17 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 				                           DUK_DEFPROP_SET_CONFIGURABLE);
 				idx += 2;
 			} while (idx < idx_end);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_INITSET:
-		case DUK_OP_INITGET: {
+		DUK__CASE(INITSET):
+		DUK__CASE(INITGET): {
 			duk__handle_op_initset_initget(thr, ins);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_MPUTARR:
-		case DUK_OP_MPUTARRI: {
+		DUK__CASE(MPUTARR):
+		DUK__CASE(MPUTARRI): {
 			duk_idx_t obj_idx;
 			duk_uint_fast_t idx, idx_end;
 			duk_small_uint_fast_t count;
@@ -5008,10 +5191,10 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			 * 'arr_idx' type.
 			 */
 			duk_set_length(thr, obj_idx, (duk_size_t) (duk_uarridx_t) arr_idx);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_SETALEN: {
+		DUK__CASE(SETALEN): {
 			duk_tval *tv1;
 			duk_hobject *h;
 			duk_uint32_t len;
@@ -5030,26 +5213,26 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			len = (duk_uint32_t) DUK_TVAL_GET_NUMBER(tv1);
 #endif
 			((duk_harray *) h)->length = len;
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_INITENUM: {
+		DUK__CASE(INITENUM): {
 			duk__handle_op_initenum(thr, ins);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_NEXTENUM: {
+		DUK__CASE(NEXTENUM): {
 			curr_pc += duk__handle_op_nextenum(thr, ins);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_INVLHS: {
+		DUK__CASE(INVLHS): {
 			DUK_ERROR_REFERENCE(thr, DUK_STR_INVALID_LVALUE);
 			DUK_WO_NORETURN(return;);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_DEBUGGER: {
+		DUK__CASE(DEBUGGER): {
 			/* Opcode only emitted by compiler when debugger
 			 * support is enabled.  Ignore it silently without
 			 * debugger support, in case it has been loaded
@@ -5068,24 +5251,24 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 #else
 			DUK_D(DUK_DPRINT("DEBUGGER statement ignored, no debugger support"));
 #endif
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_NOP: {
+		DUK__CASE(NOP): {
 			/* Nop, ignored, but ABC fields may carry a value e.g.
 			 * for indirect opcode handling.
 			 */
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
-		case DUK_OP_INVALID: {
+		DUK__CASE(INVALID): {
 			DUK_ERROR_FMT1(thr, DUK_ERR_ERROR, "INVALID opcode (%ld)", (long) DUK_DEC_ABC(ins));
 			DUK_WO_NORETURN(return;);
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
 #if defined(DUK_USE_ES6)
-		case DUK_OP_NEWTARGET: {
+		DUK__CASE(NEWTARGET): {
 			duk_push_new_target(thr);
 			DUK__REPLACE_TOP_BC_BREAK();
 		}
@@ -5093,65 +5276,61 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 
 #if !defined(DUK_USE_EXEC_PREFER_SIZE)
 #if !defined(DUK_USE_ES7_EXP_OPERATOR)
-		case DUK_OP_EXP_RR:
-		case DUK_OP_EXP_CR:
-		case DUK_OP_EXP_RC:
-		case DUK_OP_EXP_CC:
+		DUK__CASE(EXP_RR):
+		DUK__CASE(EXP_CR):
+		DUK__CASE(EXP_RC):
+		DUK__CASE(EXP_CC):
 #endif
 #if !defined(DUK_USE_ES6)
-		case DUK_OP_NEWTARGET:
+		DUK__CASE(NEWTARGET):
 #endif
 #if !defined(DUK_USE_VERBOSE_ERRORS)
-		case DUK_OP_GETPROPC_RR:
-		case DUK_OP_GETPROPC_CR:
-		case DUK_OP_GETPROPC_RC:
-		case DUK_OP_GETPROPC_CC:
+		DUK__CASE(GETPROPC_RR):
+		DUK__CASE(GETPROPC_CR):
+		DUK__CASE(GETPROPC_RC):
+		DUK__CASE(GETPROPC_CC):
 #endif
-		case DUK_OP_UNUSED207:
-		case DUK_OP_UNUSED212:
-		case DUK_OP_UNUSED213:
-		case DUK_OP_UNUSED214:
-		case DUK_OP_UNUSED215:
-		case DUK_OP_UNUSED216:
-		case DUK_OP_UNUSED217:
-		case DUK_OP_UNUSED218:
-		case DUK_OP_UNUSED219:
-		case DUK_OP_UNUSED220:
-		case DUK_OP_UNUSED221:
-		case DUK_OP_UNUSED222:
-		case DUK_OP_UNUSED223:
-		case DUK_OP_UNUSED224:
-		case DUK_OP_UNUSED225:
-		case DUK_OP_UNUSED226:
-		case DUK_OP_UNUSED227:
-		case DUK_OP_UNUSED228:
-		case DUK_OP_UNUSED229:
-		case DUK_OP_UNUSED230:
-		case DUK_OP_UNUSED231:
-		case DUK_OP_UNUSED232:
-		case DUK_OP_UNUSED233:
-		case DUK_OP_UNUSED234:
-		case DUK_OP_UNUSED235:
-		case DUK_OP_UNUSED236:
-		case DUK_OP_UNUSED237:
-		case DUK_OP_UNUSED238:
-		case DUK_OP_UNUSED239:
-		case DUK_OP_UNUSED240:
-		case DUK_OP_UNUSED241:
-		case DUK_OP_UNUSED242:
-		case DUK_OP_UNUSED243:
-		case DUK_OP_UNUSED244:
-		case DUK_OP_UNUSED245:
-		case DUK_OP_UNUSED246:
-		case DUK_OP_UNUSED247:
-		case DUK_OP_UNUSED248:
-		case DUK_OP_UNUSED249:
-		case DUK_OP_UNUSED250:
-		case DUK_OP_UNUSED251:
-		case DUK_OP_UNUSED252:
-		case DUK_OP_UNUSED253:
-		case DUK_OP_UNUSED254:
-		case DUK_OP_UNUSED255:
+		DUK__CASE(UNUSED207):
+		DUK__CASE(UNUSED216):
+		DUK__CASE(UNUSED217):
+		DUK__CASE(UNUSED218):
+		DUK__CASE(UNUSED219):
+		DUK__CASE(UNUSED220):
+		DUK__CASE(UNUSED221):
+		DUK__CASE(UNUSED222):
+		DUK__CASE(UNUSED223):
+		DUK__CASE(UNUSED224):
+		DUK__CASE(UNUSED225):
+		DUK__CASE(UNUSED226):
+		DUK__CASE(UNUSED227):
+		DUK__CASE(UNUSED228):
+		DUK__CASE(UNUSED229):
+		DUK__CASE(UNUSED230):
+		DUK__CASE(UNUSED231):
+		DUK__CASE(UNUSED232):
+		DUK__CASE(UNUSED233):
+		DUK__CASE(UNUSED234):
+		DUK__CASE(UNUSED235):
+		DUK__CASE(UNUSED236):
+		DUK__CASE(UNUSED237):
+		DUK__CASE(UNUSED238):
+		DUK__CASE(UNUSED239):
+		DUK__CASE(UNUSED240):
+		DUK__CASE(UNUSED241):
+		DUK__CASE(UNUSED242):
+		DUK__CASE(UNUSED243):
+		DUK__CASE(UNUSED244):
+		DUK__CASE(UNUSED245):
+		DUK__CASE(UNUSED246):
+		DUK__CASE(UNUSED247):
+		DUK__CASE(UNUSED248):
+		DUK__CASE(UNUSED249):
+		DUK__CASE(UNUSED250):
+		DUK__CASE(UNUSED251):
+		DUK__CASE(UNUSED252):
+		DUK__CASE(UNUSED253):
+		DUK__CASE(UNUSED254):
+		DUK__CASE(UNUSED255):
 		/* Force all case clauses to map to an actual handler
 		 * so that the compiler can emit a jump without a bounds
 		 * check: the switch argument is a duk_uint8_t so that
@@ -5159,6 +5338,9 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 		 * a small detail and obviously compiler dependent.
 		 */
 		/* default: clause omitted on purpose */
+#if defined(DUK__EXEC_CGOTO)
+		duk__op_default:  /* for opcodes without a case clause */
+#endif
 #else  /* DUK_USE_EXEC_PREFER_SIZE */
 		default:
 #endif  /* DUK_USE_EXEC_PREFER_SIZE */
@@ -5166,7 +5348,7 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 			/* Default case catches invalid/unsupported opcodes. */
 			DUK_D(DUK_DPRINT("invalid opcode: %ld - %!I", (long) op, ins));
 			DUK__INTERNAL_ERROR("invalid opcode");
-			break;
+			DUK__DISPATCH_BREAK();
 		}
 
 		}  /* end switch */
@@ -5196,3 +5378,11 @@ DUK_LOCAL DUK_NOINLINE DUK_HOT void duk__js_execute_bytecode_inner(duk_hthread *
 	DUK_WO_NORETURN(return;);
 #endif
 }
+
+#if defined(DUK__EXEC_CGOTO)
+#if defined(DUK_USE_GCC_PRAGMAS)
+#pragma GCC diagnostic pop
+#elif defined(DUK_USE_CLANG_PRAGMAS)
+#pragma clang diagnostic pop
+#endif
+#endif
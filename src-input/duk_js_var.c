@@ -185,13 +185,14 @@ void duk_js_push_closure(duk_hthread *thr,
 #endif
 
 	/* Copy duk_hobject flags as is from the template using a mask.
-	 * Leave out duk_heaphdr owned flags just in case (e.g. if there's
-	 * some GC flag or similar).  Some flags can then be adjusted
+	 * Leave out duk_heaphdr owned flags: GC flags like REACHABLE
+	 * belong to the object itself (and may be set while an incremental
+	 * mark-and-sweep is in progress).  Some flags can then be adjusted
 	 * separately if necessary.
 	 */
 
-	/* DUK_HEAPHDR_SET_FLAGS() masks changes to non-duk_heaphdr flags only. */
-	DUK_HEAPHDR_SET_FLAGS((duk_heaphdr *) fun_clos, DUK_HEAPHDR_GET_FLAGS_RAW((duk_heaphdr *) fun_temp));
+	fun_clos->obj.hdr.h_flags = (fun_clos->obj.hdr.h_flags & ~DUK_HEAPHDR_FLAGS_USER_MASK) |
+	                            (DUK_HEAPHDR_GET_FLAGS_RAW((duk_heaphdr *) fun_temp) & DUK_HEAPHDR_FLAGS_USER_MASK);
 	DUK_DD(DUK_DDPRINT("fun_temp heaphdr flags: 0x%08lx, fun_clos heaphdr flags: 0x%08lx",
 	                   (unsigned long) DUK_HEAPHDR_GET_FLAGS_RAW((duk_heaphdr *) fun_temp),
 	                   (unsigned long) DUK_HEAPHDR_GET_FLAGS_RAW((duk_heaphdr *) fun_clos)));
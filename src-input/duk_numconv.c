@@ -2,7 +2,9 @@
  *  Number-to-string and string-to-number conversions.
  *
  *  Slow path number-to-string and string-to-number conversion is based on
- *  a Dragon4 variant, with fast paths for small integers.  Big integer
+ *  a Dragon4 variant, with fast paths for small integers and (optionally)
+ *  Grisu3 for shortest radix 10 number-to-string conversion and a 64-bit
+ *  radix 10 string-to-number fast path.  Big integer
  *  arithmetic is needed for guaranteeing that the conversion is correct
  *  and uses a minimum number of digits.  The big number arithmetic has a
  *  fixed maximum size and does not require dynamic allocations.
@@ -1530,6 +1532,348 @@ DUK_LOCAL void duk__dragon4_ctx_to_double(duk__numconv_stringify_ctx *nc_ctx, du
 	*x = DUK_DBLUNION_GET_DOUBLE(&u);
 }
 
+/*
+ *  64-bit "do-it-yourself floating point" helpers and cached powers of ten,
+ *  shared by the Grisu3 number-to-string and the string-to-number fast
+ *  paths.
+ */
+
+#if defined(DUK_USE_NUMCONV_GRISU) || defined(DUK_USE_NUMCONV_PARSE_FASTPATH)
+typedef struct {
+	duk_uint64_t f;
+	duk_small_int_t e;
+} duk__diyfp;
+
+typedef struct {
+	duk_uint64_t f;
+	duk_int16_t e;  /* binary exponent */
+	duk_int16_t k;  /* decimal exponent */
+} duk__cached_power;
+
+/* Normalized 64-bit approximations of 10^k, k = -348, -340, ..., 340,
+ * generated with util/gennumpowers.py.
+ */
+#define DUK__CACHED_POWERS_MIN_K     (-348)
+#define DUK__CACHED_POWERS_MAX_K     340
+#define DUK__CACHED_POWERS_K_STEP    8
+
+DUK_LOCAL const duk__cached_power duk__cached_powers[] = {
+	{ DUK_U64_CONSTANT(0xfa8fd5a0081c0288), -1220, -348 },
+	{ DUK_U64_CONSTANT(0xbaaee17fa23ebf76), -1193, -340 },
+	{ DUK_U64_CONSTANT(0x8b16fb203055ac76), -1166, -332 },
+	{ DUK_U64_CONSTANT(0xcf42894a5dce35ea), -1140, -324 },
+	{ DUK_U64_CONSTANT(0x9a6bb0aa55653b2d), -1113, -316 },
+	{ DUK_U64_CONSTANT(0xe61acf033d1a45df), -1087, -308 },
+	{ DUK_U64_CONSTANT(0xab70fe17c79ac6ca), -1060, -300 },
+	{ DUK_U64_CONSTANT(0xff77b1fcbebcdc4f), -1034, -292 },
+	{ DUK_U64_CONSTANT(0xbe5691ef416bd60c), -1007, -284 },
+	{ DUK_U64_CONSTANT(0x8dd01fad907ffc3c), -980, -276 },
+	{ DUK_U64_CONSTANT(0xd3515c2831559a83), -954, -268 },
+	{ DUK_U64_CONSTANT(0x9d71ac8fada6c9b5), -927, -260 },
+	{ DUK_U64_CONSTANT(0xea9c227723ee8bcb), -901, -252 },
+	{ DUK_U64_CONSTANT(0xaecc49914078536d), -874, -244 },
+	{ DUK_U64_CONSTANT(0x823c12795db6ce57), -847, -236 },
+	{ DUK_U64_CONSTANT(0xc21094364dfb5637), -821, -228 },
+	{ DUK_U64_CONSTANT(0x9096ea6f3848984f), -794, -220 },
+	{ DUK_U64_CONSTANT(0xd77485cb25823ac7), -768, -212 },
+	{ DUK_U64_CONSTANT(0xa086cfcd97bf97f4), -741, -204 },
+	{ DUK_U64_CONSTANT(0xef340a98172aace5), -715, -196 },
+	{ DUK_U64_CONSTANT(0xb23867fb2a35b28e), -688, -188 },
+	{ DUK_U64_CONSTANT(0x84c8d4dfd2c63f3b), -661, -180 },
+	{ DUK_U64_CONSTANT(0xc5dd44271ad3cdba), -635, -172 },
+	{ DUK_U64_CONSTANT(0x936b9fcebb25c996), -608, -164 },
+	{ DUK_U64_CONSTANT(0xdbac6c247d62a584), -582, -156 },
+	{ DUK_U64_CONSTANT(0xa3ab66580d5fdaf6), -555, -148 },
+	{ DUK_U64_CONSTANT(0xf3e2f893dec3f126), -529, -140 },
+	{ DUK_U64_CONSTANT(0xb5b5ada8aaff80b8), -502, -132 },
+	{ DUK_U64_CONSTANT(0x87625f056c7c4a8b), -475, -124 },
+	{ DUK_U64_CONSTANT(0xc9bcff6034c13053), -449, -116 },
+	{ DUK_U64_CONSTANT(0x964e858c91ba2655), -422, -108 },
+	{ DUK_U64_CONSTANT(0xdff9772470297ebd), -396, -100 },
+	{ DUK_U64_CONSTANT(0xa6dfbd9fb8e5b88f), -369, -92 },
+	{ DUK_U64_CONSTANT(0xf8a95fcf88747d94), -343, -84 },
+	{ DUK_U64_CONSTANT(0xb94470938fa89bcf), -316, -76 },
+	{ DUK_U64_CONSTANT(0x8a08f0f8bf0f156b), -289, -68 },
+	{ DUK_U64_CONSTANT(0xcdb02555653131b6), -263, -60 },
+	{ DUK_U64_CONSTANT(0x993fe2c6d07b7fac), -236, -52 },
+	{ DUK_U64_CONSTANT(0xe45c10c42a2b3b06), -210, -44 },
+	{ DUK_U64_CONSTANT(0xaa242499697392d3), -183, -36 },
+	{ DUK_U64_CONSTANT(0xfd87b5f28300ca0e), -157, -28 },
+	{ DUK_U64_CONSTANT(0xbce5086492111aeb), -130, -20 },
+	{ DUK_U64_CONSTANT(0x8cbccc096f5088cc), -103, -12 },
+	{ DUK_U64_CONSTANT(0xd1b71758e219652c), -77, -4 },
+	{ DUK_U64_CONSTANT(0x9c40000000000000), -50, 4 },
+	{ DUK_U64_CONSTANT(0xe8d4a51000000000), -24, 12 },
+	{ DUK_U64_CONSTANT(0xad78ebc5ac620000), 3, 20 },
+	{ DUK_U64_CONSTANT(0x813f3978f8940984), 30, 28 },
+	{ DUK_U64_CONSTANT(0xc097ce7bc90715b3), 56, 36 },
+	{ DUK_U64_CONSTANT(0x8f7e32ce7bea5c70), 83, 44 },
+	{ DUK_U64_CONSTANT(0xd5d238a4abe98068), 109, 52 },
+	{ DUK_U64_CONSTANT(0x9f4f2726179a2245), 136, 60 },
+	{ DUK_U64_CONSTANT(0xed63a231d4c4fb27), 162, 68 },
+	{ DUK_U64_CONSTANT(0xb0de65388cc8ada8), 189, 76 },
+	{ DUK_U64_CONSTANT(0x83c7088e1aab65db), 216, 84 },
+	{ DUK_U64_CONSTANT(0xc45d1df942711d9a), 242, 92 },
+	{ DUK_U64_CONSTANT(0x924d692ca61be758), 269, 100 },
+	{ DUK_U64_CONSTANT(0xda01ee641a708dea), 295, 108 },
+	{ DUK_U64_CONSTANT(0xa26da3999aef774a), 322, 116 },
+	{ DUK_U64_CONSTANT(0xf209787bb47d6b85), 348, 124 },
+	{ DUK_U64_CONSTANT(0xb454e4a179dd1877), 375, 132 },
+	{ DUK_U64_CONSTANT(0x865b86925b9bc5c2), 402, 140 },
+	{ DUK_U64_CONSTANT(0xc83553c5c8965d3d), 428, 148 },
+	{ DUK_U64_CONSTANT(0x952ab45cfa97a0b3), 455, 156 },
+	{ DUK_U64_CONSTANT(0xde469fbd99a05fe3), 481, 164 },
+	{ DUK_U64_CONSTANT(0xa59bc234db398c25), 508, 172 },
+	{ DUK_U64_CONSTANT(0xf6c69a72a3989f5c), 534, 180 },
+	{ DUK_U64_CONSTANT(0xb7dcbf5354e9bece), 561, 188 },
+	{ DUK_U64_CONSTANT(0x88fcf317f22241e2), 588, 196 },
+	{ DUK_U64_CONSTANT(0xcc20ce9bd35c78a5), 614, 204 },
+	{ DUK_U64_CONSTANT(0x98165af37b2153df), 641, 212 },
+	{ DUK_U64_CONSTANT(0xe2a0b5dc971f303a), 667, 220 },
+	{ DUK_U64_CONSTANT(0xa8d9d1535ce3b396), 694, 228 },
+	{ DUK_U64_CONSTANT(0xfb9b7cd9a4a7443c), 720, 236 },
+	{ DUK_U64_CONSTANT(0xbb764c4ca7a44410), 747, 244 },
+	{ DUK_U64_CONSTANT(0x8bab8eefb6409c1a), 774, 252 },
+	{ DUK_U64_CONSTANT(0xd01fef10a657842c), 800, 260 },
+	{ DUK_U64_CONSTANT(0x9b10a4e5e9913129), 827, 268 },
+	{ DUK_U64_CONSTANT(0xe7109bfba19c0c9d), 853, 276 },
+	{ DUK_U64_CONSTANT(0xac2820d9623bf429), 880, 284 },
+	{ DUK_U64_CONSTANT(0x80444b5e7aa7cf85), 907, 292 },
+	{ DUK_U64_CONSTANT(0xbf21e44003acdd2d), 933, 300 },
+	{ DUK_U64_CONSTANT(0x8e679c2f5e44ff8f), 960, 308 },
+	{ DUK_U64_CONSTANT(0xd433179d9c8cb841), 986, 316 },
+	{ DUK_U64_CONSTANT(0x9e19db92b4e31ba9), 1013, 324 },
+	{ DUK_U64_CONSTANT(0xeb96bf6ebadf77d9), 1039, 332 },
+	{ DUK_U64_CONSTANT(0xaf87023b9bf0ee6b), 1066, 340 },
+};
+
+/* Multiply, keeping the upper 64 bits of the 128-bit product rounded. */
+DUK_LOCAL void duk__diyfp_mul(duk__diyfp *x, const duk__diyfp *y) {
+	duk_uint64_t a, b, c, d, ac, bc, ad, bd, tmp;
+
+	a = x->f >> 32;
+	b = x->f & DUK_U64_CONSTANT(0xffffffff);
+	c = y->f >> 32;
+	d = y->f & DUK_U64_CONSTANT(0xffffffff);
+	ac = a * c;
+	bc = b * c;
+	ad = a * d;
+	bd = b * d;
+	tmp = (bd >> 32) + (ad & DUK_U64_CONSTANT(0xffffffff)) + (bc & DUK_U64_CONSTANT(0xffffffff));
+	tmp += DUK_U64_CONSTANT(0x80000000);  /* round */
+	x->f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+	x->e = x->e + y->e + 64;
+}
+
+DUK_LOCAL void duk__diyfp_normalize(duk__diyfp *x) {
+	DUK_ASSERT(x->f != 0);
+	while ((x->f & DUK_U64_CONSTANT(0xffc0000000000000)) == 0) {
+		x->f <<= 10;
+		x->e -= 10;
+	}
+	while ((x->f & DUK_U64_CONSTANT(0x8000000000000000)) == 0) {
+		x->f <<= 1;
+		x->e--;
+	}
+}
+#endif  /* DUK_USE_NUMCONV_GRISU || DUK_USE_NUMCONV_PARSE_FASTPATH */
+
+/*
+ *  Grisu3 shortest number-to-string fast path, based on:
+ *
+ *    Florian Loitsch: "Printing Floating-Point Numbers Quickly and
+ *    Accurately with Integers"
+ *
+ *  Grisu3 uses 64-bit integer arithmetic with a cached power of ten and
+ *  either produces the shortest, correctly rounded digits or detects that
+ *  its precision is insufficient (roughly 0.5% of inputs), in which case
+ *  the caller falls back to Dragon4.  Only free-format radix 10 output
+ *  is supported, which covers Number.prototype.toString(), ToString()
+ *  and JSON.stringify().
+ */
+
+#if defined(DUK_USE_NUMCONV_GRISU)
+/* Target binary exponent range for scaled values, see paper. */
+#define DUK__GRISU_ALPHA  (-60)
+#define DUK__GRISU_GAMMA  (-32)
+
+/* Adjust the last digit towards the exact value 'w' while staying inside
+ * the (unsafe) rounding interval, and check that the result is guaranteed
+ * to be the closest shortest representation.  Arguments are relative to
+ * the upper end of the unsafe interval, see paper for details.
+ */
+DUK_LOCAL duk_bool_t duk__grisu3_round_weed(duk_uint8_t *digits,
+                                             duk_small_int_t count,
+                                             duk_uint64_t dist_high_w,
+                                             duk_uint64_t unsafe,
+                                             duk_uint64_t rest,
+                                             duk_uint64_t ten_kappa,
+                                             duk_uint64_t unit) {
+	duk_uint64_t small_dist = dist_high_w - unit;
+	duk_uint64_t big_dist = dist_high_w + unit;
+
+	while (rest < small_dist &&
+	       unsafe - rest >= ten_kappa &&
+	       (rest + ten_kappa < small_dist ||
+	        small_dist - rest >= rest + ten_kappa - small_dist)) {
+		digits[count - 1]--;
+		rest += ten_kappa;
+	}
+
+	/* If the same digit adjustment would also be needed for 'big_dist',
+	 * we can't tell which of the candidates is closest.
+	 */
+	if (rest < big_dist &&
+	    unsafe - rest >= ten_kappa &&
+	    (rest + ten_kappa < big_dist ||
+	     big_dist - rest > rest + ten_kappa - big_dist)) {
+		return 0;
+	}
+
+	return (2 * unit <= rest) && (rest <= unsafe - 4 * unit);
+}
+
+/* Generate shortest digits into nc_ctx->digits, setting 'count' and 'k'
+ * like Dragon4 does.  Input must be positive, finite and non-zero.
+ * Returns 0 if the result cannot be guaranteed, nc_ctx digit state is
+ * then undefined.
+ */
+DUK_LOCAL duk_bool_t duk__grisu3(duk__numconv_stringify_ctx *nc_ctx, duk_double_t x) {
+	duk_double_union u;
+	duk_uint64_t bits;
+	duk__diyfp w, m_plus, m_minus, c_mk;
+	const duk__cached_power *cp;
+	duk_small_int_t be;
+	duk_small_int_t idx;
+	duk_small_int_t kappa;
+	duk_small_int_t count;
+	duk_uint64_t unit, unsafe, one_mask, fractionals, rest;
+	duk_uint64_t too_low, too_high;
+	duk_uint32_t integrals, divisor;
+	duk_small_int_t one_shift;
+	duk_bool_t lower_closer;
+	duk_bool_t ok;
+
+	DUK_DBLUNION_SET_DOUBLE(&u, x);
+	bits = ((duk_uint64_t) DUK_DBLUNION_GET_HIGH32(&u) << 32) |
+	       (duk_uint64_t) DUK_DBLUNION_GET_LOW32(&u);
+	DUK_ASSERT((bits >> 63) == 0);
+	be = (duk_small_int_t) (bits >> 52);
+	w.f = bits & DUK_U64_CONSTANT(0x000fffffffffffff);
+	if (be == 0) {
+		/* denormal */
+		w.e = DUK__IEEE_DOUBLE_EXP_MIN - 52;
+		lower_closer = 0;
+	} else {
+		DUK_ASSERT(be < 0x7ff);
+		lower_closer = (w.f == 0 && be > 1);
+		w.f |= DUK_U64_CONSTANT(0x0010000000000000);
+		w.e = be - DUK__IEEE_DOUBLE_EXP_BIAS - 52;
+	}
+	DUK_ASSERT(w.f != 0);
+
+	/* Rounding interval boundaries, halfway to the neighbors. */
+	m_plus.f = (w.f << 1) + 1;
+	m_plus.e = w.e - 1;
+	duk__diyfp_normalize(&m_plus);
+	if (lower_closer) {
+		m_minus.f = (w.f << 2) - 1;
+		m_minus.e = w.e - 2;
+	} else {
+		m_minus.f = (w.f << 1) - 1;
+		m_minus.e = w.e - 1;
+	}
+	m_minus.f <<= m_minus.e - m_plus.e;
+	m_minus.e = m_plus.e;
+	duk__diyfp_normalize(&w);
+	DUK_ASSERT(w.e == m_plus.e);
+
+	/* Cached power c_mk = 10^-mk such that the scaled binary exponent
+	 * falls into [alpha,gamma].
+	 */
+	{
+		duk_small_int_t mk;
+
+		mk = (duk_small_int_t) DUK_CEIL((double) (DUK__GRISU_ALPHA - w.e - 1) * 0.30102999566398114);
+		idx = (-DUK__CACHED_POWERS_MIN_K + mk - 1) / DUK__CACHED_POWERS_K_STEP + 1;
+	}
+	DUK_ASSERT(idx >= 0 && idx < (duk_small_int_t) (sizeof(duk__cached_powers) / sizeof(duk__cached_power)));
+	cp = duk__cached_powers + idx;
+	c_mk.f = cp->f;
+	c_mk.e = (duk_small_int_t) cp->e;
+
+	duk__diyfp_mul(&w, &c_mk);
+	duk__diyfp_mul(&m_plus, &c_mk);
+	duk__diyfp_mul(&m_minus, &c_mk);
+	DUK_ASSERT(w.e >= DUK__GRISU_ALPHA && w.e <= DUK__GRISU_GAMMA);
+	DUK_ASSERT(m_plus.e == w.e && m_minus.e == w.e);
+
+	/* Digit generation.  The scaled boundaries may be off by one unit
+	 * in either direction so use the widened, "unsafe" interval and
+	 * weed out uncertain results at the end.
+	 */
+	unit = 1;
+	too_low = m_minus.f - unit;
+	too_high = m_plus.f + unit;
+	unsafe = too_high - too_low;
+	one_shift = -w.e;
+	one_mask = (DUK_U64_CONSTANT(1) << one_shift) - 1;
+	integrals = (duk_uint32_t) (too_high >> one_shift);
+	fractionals = too_high & one_mask;
+
+	kappa = 10;
+	divisor = 1000000000UL;
+	while (integrals < divisor) {
+		divisor /= 10;
+		kappa--;
+	}
+	DUK_ASSERT(kappa >= 1);  /* integrals >= 8 */
+
+	count = 0;
+	while (kappa > 0) {
+		nc_ctx->digits[count++] = (duk_uint8_t) (integrals / divisor);
+		integrals %= divisor;
+		kappa--;
+		rest = ((duk_uint64_t) integrals << one_shift) + fractionals;
+		if (rest < unsafe) {
+			ok = duk__grisu3_round_weed(nc_ctx->digits, count, too_high - w.f, unsafe, rest,
+			                            (duk_uint64_t) divisor << one_shift, unit);
+			goto done;
+		}
+		divisor /= 10;
+	}
+	for (;;) {
+		DUK_ASSERT(count < 20);
+		fractionals *= 10;
+		unit *= 10;
+		unsafe *= 10;
+		nc_ctx->digits[count++] = (duk_uint8_t) (fractionals >> one_shift);
+		fractionals &= one_mask;
+		kappa--;
+		if (fractionals < unsafe) {
+			ok = duk__grisu3_round_weed(nc_ctx->digits, count, (too_high - w.f) * unit, unsafe, fractionals,
+			                            one_mask + 1, unit);
+			goto done;
+		}
+	}
+
+ done:
+	if (!ok) {
+		return 0;
+	}
+
+	/* Digits are 'count' digits times 10^(kappa - k_cached); Dragon4 'k'
+	 * is the position of the first digit.  Shortest output never has
+	 * trailing zeroes.
+	 */
+	DUK_ASSERT(count >= 1 && nc_ctx->digits[0] != 0);
+	DUK_ASSERT(nc_ctx->digits[count - 1] != 0);
+	nc_ctx->count = count;
+	nc_ctx->k = count + kappa - (duk_small_int_t) cp->k;
+	return 1;
+}
+#endif  /* DUK_USE_NUMCONV_GRISU */
+
 /*
  *  Exposed number-to-string API
  *
@@ -1669,8 +2013,20 @@ DUK_LOCAL DUK_NOINLINE void duk__numconv_stringify_raw(duk_hthread *thr, duk_sma
 		nc_ctx->count = count;
 		nc_ctx->k = 1;  /* 0.000... */
 		neg = 0;
-		goto zero_skip;
+		goto skip_dragon4;
+	}
+
+#if defined(DUK_USE_NUMCONV_GRISU)
+	/* Shortest radix 10 output without special formatting: try Grisu3
+	 * first, Dragon4 is only needed when it fails.
+	 */
+	if (radix == 10 && flags == 0) {
+		if (duk__grisu3(nc_ctx, x)) {
+			goto skip_dragon4;
+		}
+		DUK_DDD(DUK_DDDPRINT("grisu3 failed, fall back to dragon4"));
 	}
+#endif
 
 	duk__dragon4_double_to_ctx(nc_ctx, x);   /* -> sets 'f' and 'e' */
 	DUK__BI_PRINT("f", &nc_ctx->f);
@@ -1702,7 +2058,7 @@ DUK_LOCAL DUK_NOINLINE void duk__numconv_stringify_raw(duk_hthread *thr, duk_sma
 	 *  Convert and push final string.
 	 */
 
- zero_skip:
+ skip_dragon4:
 
 	if (flags & DUK_N2S_FLAG_FIXED_FORMAT) {
 		/* Perform fixed-format rounding. */
@@ -1735,6 +2091,208 @@ DUK_INTERNAL void duk_numconv_stringify(duk_hthread *thr, duk_small_int_t radix,
 	duk__numconv_stringify_raw(thr, radix, digits, flags);
 }
 
+/*
+ *  String-to-number fast path
+ *
+ *  Radix 10 significands of up to 64 bits are scaled with a cached power
+ *  of ten using 64-bit arithmetic while tracking an error bound, in the
+ *  spirit of Clinger's algorithm and Eisel-Lemire but without a large
+ *  table of 128-bit powers.  If the error bound straddles a rounding
+ *  boundary the result can't be decided and the caller falls back to
+ *  Dragon4; this is rare for typical input.  Integers with a small
+ *  exponent are computed exactly so that ties round to even.
+ */
+
+#if defined(DUK_USE_NUMCONV_PARSE_FASTPATH)
+/* Exact 10^1 ... 10^7, normalized. */
+DUK_LOCAL const duk__diyfp duk__adjust_powers[] = {
+	{ DUK_U64_CONSTANT(0xa000000000000000), -60 },
+	{ DUK_U64_CONSTANT(0xc800000000000000), -57 },
+	{ DUK_U64_CONSTANT(0xfa00000000000000), -54 },
+	{ DUK_U64_CONSTANT(0x9c40000000000000), -50 },
+	{ DUK_U64_CONSTANT(0xc350000000000000), -47 },
+	{ DUK_U64_CONSTANT(0xf424000000000000), -44 },
+	{ DUK_U64_CONSTANT(0x9896800000000000), -40 }
+};
+
+/* Error bounds are in 1/8 units of the last bit of the 64-bit value. */
+#define DUK__PARSE_ERR_SHIFT  3
+#define DUK__PARSE_ERR_ONE    (1 << DUK__PARSE_ERR_SHIFT)
+#define DUK__PARSE_ERR_HALF   (DUK__PARSE_ERR_ONE / 2)
+
+/* Largest exponent for which 5^expt fits into 64 bits. */
+#define DUK__PARSE_EXACT_MAX_EXPT  27
+
+/* Full 64x64 -> 128-bit multiplication. */
+DUK_LOCAL void duk__u64_mul_full(duk_uint64_t x, duk_uint64_t y, duk_uint64_t *out_hi, duk_uint64_t *out_lo) {
+	duk_uint64_t a, b, c, d, ac, bc, ad, bd, mid;
+
+	a = x >> 32;
+	b = x & DUK_U64_CONSTANT(0xffffffff);
+	c = y >> 32;
+	d = y & DUK_U64_CONSTANT(0xffffffff);
+	ac = a * c;
+	bc = b * c;
+	ad = a * d;
+	bd = b * d;
+	mid = (bd >> 32) + (ad & DUK_U64_CONSTANT(0xffffffff)) + (bc & DUK_U64_CONSTANT(0xffffffff));
+	*out_lo = (mid << 32) | (bd & DUK_U64_CONSTANT(0xffffffff));
+	*out_hi = ac + (ad >> 32) + (bc >> 32) + (mid >> 32);
+}
+
+/* Encode a rounded value with at most 53 significant bits (or exactly 2^53
+ * after a rounding carry) as an IEEE double, handling overflow, underflow
+ * and denormals.
+ */
+DUK_LOCAL duk_double_t duk__diyfp_to_double(duk__diyfp *x) {
+	duk_double_union u;
+
+	while (x->f >= DUK_U64_CONSTANT(0x0020000000000000)) {
+		x->f >>= 1;
+		x->e++;
+	}
+	if (x->e >= 0x7ff - DUK__IEEE_DOUBLE_EXP_BIAS - 52) {
+		return DUK_DOUBLE_INFINITY;
+	}
+	if (x->e < DUK__IEEE_DOUBLE_EXP_MIN - 52) {
+		return 0.0;
+	}
+	while (x->e > DUK__IEEE_DOUBLE_EXP_MIN - 52 && (x->f & DUK_U64_CONSTANT(0x0010000000000000)) == 0) {
+		x->f <<= 1;
+		x->e--;
+	}
+	if ((x->f & DUK_U64_CONSTANT(0x0010000000000000)) == 0) {
+		/* denormal */
+		DUK_ASSERT(x->e == DUK__IEEE_DOUBLE_EXP_MIN - 52);
+		x->e = 0;
+	} else {
+		x->e += DUK__IEEE_DOUBLE_EXP_BIAS + 52;
+	}
+	DUK_ASSERT(x->e >= 0 && x->e < 0x7ff);
+	DUK_DBLUNION_SET_HIGH32(&u, (duk_uint32_t) ((x->f >> 32) & 0x000fffffUL) | ((duk_uint32_t) x->e << 20));
+	DUK_DBLUNION_SET_LOW32(&u, (duk_uint32_t) x->f);
+	return DUK_DBLUNION_GET_DOUBLE(&u);
+}
+
+/* Compute 'f * 10^expt' where 'f' has 'dig_prec' decimal digits.  Returns
+ * 0 if the correctly rounded result cannot be guaranteed.
+ */
+DUK_LOCAL duk_bool_t duk__parse_fastpath(duk_uint64_t f, duk_small_int_t dig_prec, duk_small_int_t expt, duk_double_t *out) {
+	duk__diyfp x;
+	duk__diyfp c;
+	const duk__cached_power *cp;
+	duk_uint64_t err;
+	duk_uint64_t prec_bits, half_way;
+	duk_small_int_t adj;
+	duk_small_int_t old_e;
+	duk_small_int_t magnitude;
+	duk_small_int_t prec_count;
+	duk_small_int_t shift;
+
+	DUK_ASSERT(f != 0);
+	DUK_ASSERT(expt >= DUK__CACHED_POWERS_MIN_K && expt < DUK__CACHED_POWERS_MAX_K + DUK__CACHED_POWERS_K_STEP);
+
+	x.f = f;
+	x.e = 0;
+
+	if (expt >= 0 && expt <= DUK__PARSE_EXACT_MAX_EXPT) {
+		/* Integer value: f * 10^expt = (f * 5^expt) * 2^expt with the
+		 * product computed exactly in 128 bits, so that rounding (ties
+		 * to even) can be done exactly.
+		 */
+		duk_uint64_t p5, hi, lo;
+
+		p5 = 1U;
+		for (shift = 0; shift < expt; shift++) {
+			p5 *= 5U;
+		}
+		duk__u64_mul_full(f, p5, &hi, &lo);
+		if (hi == 0) {
+			x.f = lo;
+			x.e = expt;
+			lo = 0;
+		} else {
+			x.e = expt + 64;
+			while ((hi & DUK_U64_CONSTANT(0x8000000000000000)) == 0) {
+				hi = (hi << 1) | (lo >> 63);
+				lo <<= 1;
+				x.e--;
+			}
+			x.f = hi;
+		}
+		duk__diyfp_normalize(&x);
+
+		/* 'lo' is now nonzero iff bits below the 64-bit 'x.f' are set. */
+		prec_bits = x.f & DUK_U64_CONSTANT(0x7ff);
+		x.f >>= 11;
+		x.e += 11;
+		if (prec_bits > 0x400U || (prec_bits == 0x400U && (lo != 0 || (x.f & 1U)))) {
+			x.f++;
+		}
+		*out = duk__diyfp_to_double(&x);
+		return 1;
+	}
+
+	duk__diyfp_normalize(&x);
+	err = 0;
+
+	/* Cached power at or below 10^expt, plus an exact adjustment. */
+	cp = duk__cached_powers + (expt - DUK__CACHED_POWERS_MIN_K) / DUK__CACHED_POWERS_K_STEP;
+	adj = expt - (duk_small_int_t) cp->k;
+	DUK_ASSERT(adj >= 0 && adj < DUK__CACHED_POWERS_K_STEP);
+	if (adj > 0) {
+		duk__diyfp_mul(&x, &duk__adjust_powers[adj - 1]);
+		if (19 - dig_prec < adj) {
+			/* Product doesn't fit in 64 bits so it was rounded. */
+			err += DUK__PARSE_ERR_HALF;
+		}
+	}
+	c.f = cp->f;
+	c.e = (duk_small_int_t) cp->e;
+	duk__diyfp_mul(&x, &c);
+
+	/* Cached power rounding, error propagation, and product rounding. */
+	err += (duk_uint64_t) (DUK__PARSE_ERR_HALF + (err == 0 ? 0 : 1) + DUK__PARSE_ERR_HALF);
+
+	old_e = x.e;
+	duk__diyfp_normalize(&x);
+	err <<= old_e - x.e;
+
+	/* Number of low bits which don't fit into the result significand;
+	 * more than 11 for denormals.
+	 */
+	magnitude = 64 + x.e;
+	if (magnitude >= -1074 + 53) {
+		prec_count = 64 - 53;
+	} else if (magnitude <= -1074) {
+		prec_count = 64;
+	} else {
+		prec_count = 64 - (magnitude + 1074);
+	}
+	if (prec_count + DUK__PARSE_ERR_SHIFT >= 64) {
+		shift = prec_count + DUK__PARSE_ERR_SHIFT - 64 + 1;
+		x.f >>= shift;
+		x.e += shift;
+		err = (err >> shift) + 1 + DUK__PARSE_ERR_ONE;
+		prec_count -= shift;
+	}
+
+	prec_bits = (x.f & ((DUK_U64_CONSTANT(1) << prec_count) - 1)) * DUK__PARSE_ERR_ONE;
+	half_way = (DUK_U64_CONSTANT(1) << (prec_count - 1)) * DUK__PARSE_ERR_ONE;
+	if (half_way - err < prec_bits && prec_bits < half_way + err) {
+		return 0;
+	}
+	x.f >>= prec_count;
+	x.e += prec_count;
+	if (prec_bits >= half_way + err) {
+		x.f++;
+	}
+
+	*out = duk__diyfp_to_double(&x);
+	return 1;
+}
+#endif  /* DUK_USE_NUMCONV_PARSE_FASTPATH */
+
 /*
  *  Exposed string-to-number API
  *
@@ -2162,6 +2720,27 @@ DUK_LOCAL DUK_NOINLINE void duk__numconv_parse_raw(duk_hthread *thr, duk_small_i
 		goto negcheck_and_ret;
 	}
 
+#if defined(DUK_USE_NUMCONV_PARSE_FASTPATH)
+	/* 64-bit significand with a moderate exponent: the fast path usually
+	 * gives a guaranteed result without bigint arithmetic.
+	 */
+	if (radix == 10 && nc_ctx->f.n >= 1 && nc_ctx->f.n <= 2 &&
+	    expt >= DUK__CACHED_POWERS_MIN_K &&
+	    expt < DUK__CACHED_POWERS_MAX_K + DUK__CACHED_POWERS_K_STEP) {
+		duk_uint64_t f64;
+
+		f64 = (duk_uint64_t) nc_ctx->f.v[0];
+		if (nc_ctx->f.n == 2) {
+			f64 |= ((duk_uint64_t) nc_ctx->f.v[1]) << 32;
+		}
+		if (duk__parse_fastpath(f64, dig_prec, (duk_small_int_t) expt, &res)) {
+			DUK_DDD(DUK_DDDPRINT("parse fast path succeeded"));
+			goto negcheck_and_ret;
+		}
+		DUK_DDD(DUK_DDDPRINT("parse fast path failed, fall back to dragon4"));
+	}
+#endif
+
 	/* Significand ('f') padding. */
 
 	while (dig_prec < duk__str2num_digits_for_radix[radix - 2]) {
@@ -24,6 +24,22 @@
 #define DUK_HEAPHDR_NEEDS_REFCOUNT_UPDATE(h)  1
 #endif  /* DUK_USE_ROM_OBJECTS */
 
+/* Write barrier for incremental mark-and-sweep: a heap object getting a new
+ * reference while a cycle is in progress is marked, so that an already
+ * scanned object never ends up pointing to an unmarked one.  All strong
+ * references are refcounted, so hooking INCREF covers property writes,
+ * register writes, and value stack pushes.
+ */
+#if defined(DUK_USE_INCREMENTAL_GC)
+#define DUK_HEAPHDR_GC_BARRIER(thr,h) do { \
+		if (DUK_UNLIKELY((thr)->heap->ms_incremental == DUK_HEAP_MS_INCR_MARK && !DUK_HEAPHDR_HAS_REACHABLE((h)))) { \
+			duk_heap_mark_barrier((thr)->heap, (h)); \
+		} \
+	} while (0)
+#else
+#define DUK_HEAPHDR_GC_BARRIER(thr,h) do {} while (0)
+#endif
+
 /* Fast variants, inline refcount operations except for refzero handling.
  * Can be used explicitly when speed is always more important than size.
  * For a good compiler and a single file build, these are basically the
@@ -38,6 +54,7 @@
 			DUK_ASSERT(DUK_HEAPHDR_HTYPE_VALID(duk__h)); \
 			DUK_HEAPHDR_PREINC_REFCOUNT(duk__h); \
 			DUK_ASSERT(DUK_HEAPHDR_GET_REFCOUNT(duk__h) != 0);  /* No wrapping. */ \
+			DUK_HEAPHDR_GC_BARRIER((thr), duk__h); \
 		} \
 	} while (0)
 #define DUK_TVAL_DECREF_FAST(thr,tv) do { \
@@ -73,6 +90,7 @@
 		if (DUK_HEAPHDR_NEEDS_REFCOUNT_UPDATE(duk__h)) { \
 			DUK_HEAPHDR_PREINC_REFCOUNT(duk__h); \
 			DUK_ASSERT(DUK_HEAPHDR_GET_REFCOUNT(duk__h) != 0);  /* No wrapping. */ \
+			DUK_HEAPHDR_GC_BARRIER((thr), duk__h); \
 		} \
 	} while (0)
 #define DUK_HEAPHDR_DECREF_FAST_RAW(thr,h,rzcall,rzcast) do { \
@@ -93,20 +111,31 @@
 
 /* Slow variants, call to a helper to reduce code size.
  * Can be used explicitly when size is always more important than speed.
+ * The INCREF helpers don't get a heap pointer, so with incremental
+ * mark-and-sweep the INCREF variants map to the fast ones instead to
+ * get the write barrier.
  */
+#if defined(DUK_USE_INCREMENTAL_GC)
+#define DUK_TVAL_INCREF_SLOW(thr,tv)         DUK_TVAL_INCREF_FAST((thr),(tv))
+#define DUK_HEAPHDR_INCREF_SLOW(thr,h)       DUK_HEAPHDR_INCREF_FAST((thr),(h))
+#define DUK_HSTRING_INCREF_SLOW(thr,h)       DUK_HEAPHDR_INCREF_FAST((thr),(h))
+#define DUK_HBUFFER_INCREF_SLOW(thr,h)       DUK_HEAPHDR_INCREF_FAST((thr),(h))
+#define DUK_HOBJECT_INCREF_SLOW(thr,h)       DUK_HEAPHDR_INCREF_FAST((thr),(h))
+#else
 #define DUK_TVAL_INCREF_SLOW(thr,tv)         do { duk_tval_incref((tv)); } while (0)
+#define DUK_HEAPHDR_INCREF_SLOW(thr,h)       do { duk_heaphdr_incref((duk_heaphdr *) (h)); } while (0)
+#define DUK_HSTRING_INCREF_SLOW(thr,h)       do { duk_heaphdr_incref((duk_heaphdr *) (h)); } while (0)
+#define DUK_HBUFFER_INCREF_SLOW(thr,h)       do { duk_heaphdr_incref((duk_heaphdr *) (h)); } while (0)
+#define DUK_HOBJECT_INCREF_SLOW(thr,h)       do { duk_heaphdr_incref((duk_heaphdr *) (h)); } while (0)
+#endif
 #define DUK_TVAL_DECREF_SLOW(thr,tv)         do { duk_tval_decref((thr), (tv)); } while (0)
 #define DUK_TVAL_DECREF_NORZ_SLOW(thr,tv)    do { duk_tval_decref_norz((thr), (tv)); } while (0)
-#define DUK_HEAPHDR_INCREF_SLOW(thr,h)       do { duk_heaphdr_incref((duk_heaphdr *) (h)); } while (0)
 #define DUK_HEAPHDR_DECREF_SLOW(thr,h)       do { duk_heaphdr_decref((thr), (duk_heaphdr *) (h)); } while (0)
 #define DUK_HEAPHDR_DECREF_NORZ_SLOW(thr,h)  do { duk_heaphdr_decref_norz((thr), (duk_heaphdr *) (h)); } while (0)
-#define DUK_HSTRING_INCREF_SLOW(thr,h)       do { duk_heaphdr_incref((duk_heaphdr *) (h)); } while (0)
 #define DUK_HSTRING_DECREF_SLOW(thr,h)       do { duk_heaphdr_decref((thr), (duk_heaphdr *) (h)); } while (0)
 #define DUK_HSTRING_DECREF_NORZ_SLOW(thr,h)  do { duk_heaphdr_decref_norz((thr), (duk_heaphdr *) (h)); } while (0)
-#define DUK_HBUFFER_INCREF_SLOW(thr,h)       do { duk_heaphdr_incref((duk_heaphdr *) (h)); } while (0)
 #define DUK_HBUFFER_DECREF_SLOW(thr,h)       do { duk_heaphdr_decref((thr), (duk_heaphdr *) (h)); } while (0)
 #define DUK_HBUFFER_DECREF_NORZ_SLOW(thr,h)  do { duk_heaphdr_decref_norz((thr), (duk_heaphdr *) (h)); } while (0)
-#define DUK_HOBJECT_INCREF_SLOW(thr,h)       do { duk_heaphdr_incref((duk_heaphdr *) (h)); } while (0)
 #define DUK_HOBJECT_DECREF_SLOW(thr,h)       do { duk_heaphdr_decref((thr), (duk_heaphdr *) (h)); } while (0)
 #define DUK_HOBJECT_DECREF_NORZ_SLOW(thr,h)  do { duk_heaphdr_decref_norz((thr), (duk_heaphdr *) (h)); } while (0)
 
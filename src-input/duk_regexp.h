@@ -14,6 +14,16 @@
 /* regexp execution limits */
 #define DUK_RE_EXECUTE_STEPS_LIMIT         1000000000L  /* 1e9 */
 
+/* Pike VM fallback: backtracking step budget (base + per input byte) after
+ * which an eligible regexp is rematched with the Pike VM, maximum simple
+ * quantifier count tracked in Pike VM thread state, and maximum number of
+ * (pc, count) thread states.
+ */
+#define DUK_RE_PIKEVM_STEPS_BASE           10000L
+#define DUK_RE_PIKEVM_STEPS_PER_BYTE       16L
+#define DUK_RE_PIKEVM_MAX_COUNT            64L
+#define DUK_RE_PIKEVM_MAX_STATES           1000000L
+
 /* regexp opcodes */
 #define DUK_REOP_MATCH                     1
 #define DUK_REOP_CHAR                      2
@@ -39,6 +49,7 @@
 #define DUK_RE_FLAG_GLOBAL                 (1U << 0)
 #define DUK_RE_FLAG_IGNORE_CASE            (1U << 1)
 #define DUK_RE_FLAG_MULTILINE              (1U << 2)
+#define DUK_RE_FLAG_PIKEVM                 (1U << 3)  /* internal: no backreferences or lookaheads, Pike VM fallback allowed */
 
 struct duk_re_matcher_ctx {
 	duk_hthread *thr;
@@ -54,6 +65,9 @@ struct duk_re_matcher_ctx {
 	duk_uint32_t recursion_limit;
 	duk_uint32_t steps_count;
 	duk_uint32_t steps_limit;
+#if defined(DUK_USE_REGEXP_PIKEVM)
+	duk_bool_t pikevm_bailout;  /* backtracking gave up, rematch with the Pike VM */
+#endif
 };
 
 struct duk_re_compiler_ctx {
@@ -68,6 +82,10 @@ struct duk_re_compiler_ctx {
 	duk_uint32_t recursion_depth;
 	duk_uint32_t recursion_limit;
 	duk_uint32_t nranges;  /* internal temporary value, used for char classes */
+#if defined(DUK_USE_REGEXP_PIKEVM)
+	duk_bool_t has_lookahead;
+	duk_uint32_t pikevm_maxcount;  /* highest simple quantifier count tracked by the Pike VM */
+#endif
 };
 
 /*
@@ -634,6 +634,20 @@ DUK_LOCAL void duk__parse_disjunction(duk_re_compiler_ctx *re_ctx, duk_bool_t ex
 					}
 				}
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+				{
+					/* Pike VM threads track the iteration count up to
+					 * qmax, or up to qmin for an unbounded quantifier.
+					 */
+					duk_uint32_t qcount;
+
+					qcount = (qmax == DUK_RE_QUANTIFIER_INFINITE ? qmin : qmax);
+					if (qcount > re_ctx->pikevm_maxcount) {
+						re_ctx->pikevm_maxcount = qcount;
+					}
+				}
+#endif
+
 				duk__append_reop(re_ctx, DUK_REOP_MATCH);   /* complete 'sub atom' */
 				atom_code_length = (duk_int32_t) (DUK__RE_BUFLEN(re_ctx) - (duk_size_t) atom_start_offset);
 
@@ -785,6 +799,9 @@ DUK_LOCAL void duk__parse_disjunction(duk_re_compiler_ctx *re_ctx, duk_bool_t ex
 			duk_uint32_t opcode = (re_ctx->curr_token.t == DUK_RETOK_ASSERT_START_POS_LOOKAHEAD) ?
 			                      DUK_REOP_LOOKPOS : DUK_REOP_LOOKNEG;
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+			re_ctx->has_lookahead = 1;
+#endif
 			offset = (duk_uint32_t) DUK__RE_BUFLEN(re_ctx);
 			duk__parse_disjunction(re_ctx, 0, &tmp_disj);
 			duk__append_reop(re_ctx, DUK_REOP_MATCH);
@@ -1211,6 +1228,22 @@ DUK_INTERNAL void duk_regexp_compile(duk_hthread *thr) {
 		DUK_WO_NORETURN(return;);
 	}
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+	/*
+	 *  Flag regexps which the executor may rematch with the Pike VM if
+	 *  backtracking becomes too expensive: backreferences and lookaheads
+	 *  are not supported by the Pike VM, and its thread state table size
+	 *  is limited.
+	 */
+
+	if (re_ctx.highest_backref == 0 &&
+	    !re_ctx.has_lookahead &&
+	    re_ctx.pikevm_maxcount <= DUK_RE_PIKEVM_MAX_COUNT &&
+	    DUK_BW_GET_SIZE(thr, &re_ctx.bw) <= (duk_size_t) (DUK_RE_PIKEVM_MAX_STATES / (re_ctx.pikevm_maxcount + 1))) {
+		re_ctx.re_flags |= DUK_RE_FLAG_PIKEVM;
+	}
+#endif
+
 	/*
 	 *  Emit compiled regexp header: flags, ncaptures
 	 *  (insertion order inverted on purpose)
@@ -134,6 +134,100 @@ DUK_LOCAL duk_codepoint_t duk__inp_get_prev_cp(duk_re_matcher_ctx *re_ctx, const
 	return duk__inp_get_cp(re_ctx, &sp);
 }
 
+/*
+ *  Helpers shared by the backtracking matcher and the Pike VM
+ */
+
+/* Match codepoint 'c' against 'n' ranges in bytecode, consuming all of them. */
+DUK_LOCAL duk_bool_t duk__match_ranges(duk_re_matcher_ctx *re_ctx, const duk_uint8_t **pc, duk_uint32_t n, duk_codepoint_t c) {
+	duk_bool_t match = 0;
+
+	while (n) {
+		duk_codepoint_t r1, r2;
+		r1 = (duk_codepoint_t) duk__bc_get_u32(re_ctx, pc);
+		r2 = (duk_codepoint_t) duk__bc_get_u32(re_ctx, pc);
+		DUK_DDD(DUK_DDDPRINT("matching ranges/invranges, n=%ld, r1=%ld, r2=%ld, c=%ld",
+		                     (long) n, (long) r1, (long) r2, (long) c));
+		if (c >= r1 && c <= r2) {
+			/* Note: don't bail out early, we must read all the ranges from
+			 * bytecode.  Another option is to skip them efficiently after
+			 * breaking out of here.  Prefer smallest code.
+			 */
+			match = 1;
+		}
+		n--;
+	}
+	return match;
+}
+
+/* Check an ASSERT_xxx opcode at input position 'sp'. */
+DUK_LOCAL duk_bool_t duk__match_assertion(duk_re_matcher_ctx *re_ctx, duk_small_int_t op, const duk_uint8_t *sp) {
+	switch (op) {
+	case DUK_REOP_ASSERT_START: {
+		duk_codepoint_t c;
+
+		if (sp <= re_ctx->input) {
+			return 1;
+		}
+		if (!(re_ctx->re_flags & DUK_RE_FLAG_MULTILINE)) {
+			return 0;
+		}
+		c = duk__inp_get_prev_cp(re_ctx, sp);
+		/* E5 Sections 15.10.2.8, 7.3 */
+		return (duk_bool_t) duk_unicode_is_line_terminator(c);
+	}
+	case DUK_REOP_ASSERT_END: {
+		duk_codepoint_t c;
+		const duk_uint8_t *tmp_sp;
+
+		tmp_sp = sp;
+		c = duk__inp_get_cp(re_ctx, &tmp_sp);
+		if (c < 0) {
+			return 1;
+		}
+		if (!(re_ctx->re_flags & DUK_RE_FLAG_MULTILINE)) {
+			return 0;
+		}
+		/* E5 Sections 15.10.2.8, 7.3 */
+		return (duk_bool_t) duk_unicode_is_line_terminator(c);
+	}
+	default: {
+		/*
+		 *  E5 Section 15.10.2.6.  The previous and current character
+		 *  should -not- be canonicalized as they are now.  However,
+		 *  canonicalization does not affect the result of IsWordChar()
+		 *  (which depends on Unicode characters never canonicalizing
+		 *  into ASCII characters) so this does not matter.
+		 */
+		duk_small_int_t w1, w2;
+
+		DUK_ASSERT(op == DUK_REOP_ASSERT_WORD_BOUNDARY || op == DUK_REOP_ASSERT_NOT_WORD_BOUNDARY);
+
+		if (sp <= re_ctx->input) {
+			w1 = 0;  /* not a wordchar */
+		} else {
+			duk_codepoint_t c;
+			c = duk__inp_get_prev_cp(re_ctx, sp);
+			w1 = duk_unicode_re_is_wordchar(c);
+		}
+		if (sp >= re_ctx->input_end) {
+			w2 = 0;  /* not a wordchar */
+		} else {
+			const duk_uint8_t *tmp_sp = sp;  /* dummy so sp won't get updated */
+			duk_codepoint_t c;
+			c = duk__inp_get_cp(re_ctx, &tmp_sp);
+			w2 = duk_unicode_re_is_wordchar(c);
+		}
+
+		if (op == DUK_REOP_ASSERT_WORD_BOUNDARY) {
+			return (w1 != w2);
+		} else {
+			return (w1 == w2);
+		}
+	}
+	}
+}
+
 /*
  *  Regexp recursive matching function.
  *
@@ -148,6 +242,17 @@ DUK_LOCAL duk_codepoint_t duk__inp_get_prev_cp(duk_re_matcher_ctx *re_ctx, const
 DUK_LOCAL const duk_uint8_t *duk__match_regexp(duk_re_matcher_ctx *re_ctx, const duk_uint8_t *pc, const duk_uint8_t *sp) {
 	duk_native_stack_check(re_ctx->thr);
 	if (re_ctx->recursion_depth >= re_ctx->recursion_limit) {
+#if defined(DUK_USE_REGEXP_PIKEVM)
+		if (re_ctx->re_flags & DUK_RE_FLAG_PIKEVM) {
+			/* Zero step limit makes all pending alternatives
+			 * fail (see below) so that the caller can rematch
+			 * with the Pike VM.
+			 */
+			re_ctx->pikevm_bailout = 1;
+			re_ctx->steps_limit = 0;
+			return NULL;
+		}
+#endif
 		DUK_ERROR_RANGE(re_ctx->thr, DUK_STR_REGEXP_EXECUTOR_RECURSION_LIMIT);
 		DUK_WO_NORETURN(return NULL;);
 	}
@@ -157,6 +262,16 @@ DUK_LOCAL const duk_uint8_t *duk__match_regexp(duk_re_matcher_ctx *re_ctx, const
 		duk_small_int_t op;
 
 		if (re_ctx->steps_count >= re_ctx->steps_limit) {
+#if defined(DUK_USE_REGEXP_PIKEVM)
+			if (re_ctx->re_flags & DUK_RE_FLAG_PIKEVM) {
+				/* Backtracking budget exhausted: fail here and in
+				 * every pending alternative, and let the caller
+				 * rematch with the Pike VM.
+				 */
+				re_ctx->pikevm_bailout = 1;
+				goto fail;
+			}
+#endif
 			DUK_ERROR_RANGE(re_ctx->thr, DUK_STR_REGEXP_EXECUTOR_STEP_LIMIT);
 			DUK_WO_NORETURN(return NULL;);
 		}
@@ -233,7 +348,7 @@ DUK_LOCAL const duk_uint8_t *duk__match_regexp(duk_re_matcher_ctx *re_ctx, const
 		case DUK_REOP_INVRANGES: {
 			duk_uint32_t n;
 			duk_codepoint_t c;
-			duk_small_int_t match;
+			duk_bool_t match;
 
 			n = duk__bc_get_u32(re_ctx, &pc);
 			c = duk__inp_get_cp(re_ctx, &sp);
@@ -241,22 +356,7 @@ DUK_LOCAL const duk_uint8_t *duk__match_regexp(duk_re_matcher_ctx *re_ctx, const
 				goto fail;
 			}
 
-			match = 0;
-			while (n) {
-				duk_codepoint_t r1, r2;
-				r1 = (duk_codepoint_t) duk__bc_get_u32(re_ctx, &pc);
-				r2 = (duk_codepoint_t) duk__bc_get_u32(re_ctx, &pc);
-				DUK_DDD(DUK_DDDPRINT("matching ranges/invranges, n=%ld, r1=%ld, r2=%ld, c=%ld",
-				                     (long) n, (long) r1, (long) r2, (long) c));
-				if (c >= r1 && c <= r2) {
-					/* Note: don't bail out early, we must read all the ranges from
-					 * bytecode.  Another option is to skip them efficiently after
-					 * breaking out of here.  Prefer smallest code.
-					 */
-					match = 1;
-				}
-				n--;
-			}
+			match = duk__match_ranges(re_ctx, &pc, n, c);
 
 			if (op == DUK_REOP_RANGES) {
 				if (!match) {
@@ -270,76 +370,12 @@ DUK_LOCAL const duk_uint8_t *duk__match_regexp(duk_re_matcher_ctx *re_ctx, const
 			}
 			break;
 		}
-		case DUK_REOP_ASSERT_START: {
-			duk_codepoint_t c;
-
-			if (sp <= re_ctx->input) {
-				break;
-			}
-			if (!(re_ctx->re_flags & DUK_RE_FLAG_MULTILINE)) {
-				goto fail;
-			}
-			c = duk__inp_get_prev_cp(re_ctx, sp);
-			if (duk_unicode_is_line_terminator(c)) {
-				/* E5 Sections 15.10.2.8, 7.3 */
-				break;
-			}
-			goto fail;
-		}
-		case DUK_REOP_ASSERT_END: {
-			duk_codepoint_t c;
-			const duk_uint8_t *tmp_sp;
-
-			tmp_sp = sp;
-			c = duk__inp_get_cp(re_ctx, &tmp_sp);
-			if (c < 0) {
-				break;
-			}
-			if (!(re_ctx->re_flags & DUK_RE_FLAG_MULTILINE)) {
-				goto fail;
-			}
-			if (duk_unicode_is_line_terminator(c)) {
-				/* E5 Sections 15.10.2.8, 7.3 */
-				break;
-			}
-			goto fail;
-		}
+		case DUK_REOP_ASSERT_START:
+		case DUK_REOP_ASSERT_END:
 		case DUK_REOP_ASSERT_WORD_BOUNDARY:
 		case DUK_REOP_ASSERT_NOT_WORD_BOUNDARY: {
-			/*
-			 *  E5 Section 15.10.2.6.  The previous and current character
-			 *  should -not- be canonicalized as they are now.  However,
-			 *  canonicalization does not affect the result of IsWordChar()
-			 *  (which depends on Unicode characters never canonicalizing
-			 *  into ASCII characters) so this does not matter.
-			 */
-			duk_small_int_t w1, w2;
-
-			if (sp <= re_ctx->input) {
-				w1 = 0;  /* not a wordchar */
-			} else {
-				duk_codepoint_t c;
-				c = duk__inp_get_prev_cp(re_ctx, sp);
-				w1 = duk_unicode_re_is_wordchar(c);
-			}
-			if (sp >= re_ctx->input_end) {
-				w2 = 0;  /* not a wordchar */
-			} else {
-				const duk_uint8_t *tmp_sp = sp;  /* dummy so sp won't get updated */
-				duk_codepoint_t c;
-				c = duk__inp_get_cp(re_ctx, &tmp_sp);
-				w2 = duk_unicode_re_is_wordchar(c);
-			}
-
-			if (op == DUK_REOP_ASSERT_WORD_BOUNDARY) {
-				if (w1 == w2) {
-					goto fail;
-				}
-			} else {
-				DUK_ASSERT(op == DUK_REOP_ASSERT_NOT_WORD_BOUNDARY);
-				if (w1 != w2) {
-					goto fail;
-				}
+			if (!duk__match_assertion(re_ctx, op, sp)) {
+				goto fail;
 			}
 			break;
 		}
@@ -671,6 +707,603 @@ DUK_LOCAL const duk_uint8_t *duk__match_regexp(duk_re_matcher_ctx *re_ctx, const
 	DUK_WO_NORETURN(return NULL;);
 }
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+/*
+ *  Pike VM matcher.
+ *
+ *  Used as a fallback for regexps flagged by the compiler with
+ *  DUK_RE_FLAG_PIKEVM (no backreferences or lookaheads) when the
+ *  backtracking matcher exceeds its step budget or recursion limit.
+ *
+ *  All threads advance in lockstep over the input, one codepoint at a time,
+ *  so matching takes O(n*m) steps for input length n and bytecode size m,
+ *  without C recursion.  Threads are kept in priority order (the order in
+ *  which the backtracking matcher would try them) and each thread state is
+ *  added at most once per input position; a lower priority thread reaching
+ *  the same state can never produce the match the backtracking matcher
+ *  would.  When a thread matches, lower priority threads are cut off, and
+ *  matching continues until the remaining higher priority threads die.
+ *  This gives the same results as the backtracking matcher.
+ *
+ *  The bytecode is interpreted directly.  The only bytecode construct which
+ *  needs state besides the pc is a simple quantifier (SQMINIMAL/SQGREEDY):
+ *  its atom has a fixed length and no branches or captures, so a thread
+ *  can be inside at most one of them, and the state is (pc, iteration
+ *  count).  For an unbounded quantifier the count is saturated at qmin,
+ *  so the compiler bounds the number of counts per pc.
+ */
+
+#define DUK__PIKE_NONE     0xffffffffUL  /* thread not inside a simple quantifier atom */
+#define DUK__PIKE_RESTORE  0xffffffffUL  /* closure stack entry which restores a capture */
+
+typedef struct {
+	duk_uint32_t pc;     /* bytecode offset (relative to re_ctx->bytecode) */
+	duk_uint32_t count;  /* simple quantifier iteration count */
+	duk_uint32_t sq;     /* bytecode offset of active simple quantifier, DUK__PIKE_NONE if none */
+} duk__re_pike_thread;
+
+typedef struct {
+	duk__re_pike_thread st;  /* st.pc == DUK__PIKE_RESTORE: restore saved[st.count] = ptr */
+	const duk_uint8_t *ptr;
+} duk__re_pike_stackent;
+
+typedef struct {
+	duk__re_pike_thread *threads;
+	const duk_uint8_t **saved;  /* nsaved entries per thread */
+	duk_uint32_t count;
+} duk__re_pike_list;
+
+typedef struct {
+	duk_re_matcher_ctx *re_ctx;
+	duk_uint32_t bc_len;
+	duk_uint32_t ncount;            /* number of iteration counts tracked per pc */
+	duk_uint32_t *visited;          /* [bc_len * ncount], generation when state was last added */
+	duk_uint32_t gen;               /* current generation, one per input position */
+	duk__re_pike_stackent *stack;   /* closure stack */
+	duk_size_t stack_size;
+	duk_size_t list_size;           /* thread list capacity */
+	const duk_uint8_t **saved;      /* working captures for closure */
+} duk__re_pike_ctx;
+
+DUK_LOCAL duk_size_t duk__pike_mul(duk_hthread *thr, duk_size_t a, duk_size_t b) {
+	if (b != 0 && a > DUK_SIZE_MAX / b) {
+		DUK_ERROR_RANGE(thr, DUK_STR_BUFFER_TOO_LONG);
+		DUK_WO_NORETURN(return 0;);
+	}
+	return a * b;
+}
+
+DUK_LOCAL void duk__pike_count_step(duk_re_matcher_ctx *re_ctx) {
+	if (DUK_UNLIKELY(re_ctx->steps_count >= re_ctx->steps_limit)) {
+		DUK_ERROR_RANGE(re_ctx->thr, DUK_STR_REGEXP_EXECUTOR_STEP_LIMIT);
+		DUK_WO_NORETURN(return;);
+	}
+	re_ctx->steps_count++;
+}
+
+/* Scan the bytecode for table sizes: number of input consuming instructions
+ * (thread list size per count), worst case closure stack pushes, and the
+ * highest simple quantifier count tracked.
+ */
+DUK_LOCAL void duk__pike_scan(duk_re_matcher_ctx *re_ctx, duk_size_t *out_nconsume, duk_size_t *out_npush, duk_uint32_t *out_maxcount) {
+	const duk_uint8_t *pc;
+	duk_size_t nconsume = 0;
+	duk_size_t npush = 0;
+	duk_uint32_t maxcount = 0;
+
+	pc = re_ctx->bytecode;
+	while (pc < re_ctx->bytecode_end) {
+		duk_small_int_t op;
+
+		op = *pc++;
+		switch (op) {
+		case DUK_REOP_MATCH: {
+			npush += 1;
+			break;
+		}
+		case DUK_REOP_CHAR: {
+			(void) duk__bc_get_u32(re_ctx, &pc);
+			nconsume++;
+			break;
+		}
+		case DUK_REOP_PERIOD: {
+			nconsume++;
+			break;
+		}
+		case DUK_REOP_RANGES:
+		case DUK_REOP_INVRANGES: {
+			duk_uint32_t n;
+
+			n = duk__bc_get_u32(re_ctx, &pc);
+			(void) duk__match_ranges(re_ctx, &pc, n, -1);
+			nconsume++;
+			break;
+		}
+		case DUK_REOP_JUMP: {
+			(void) duk__bc_get_i32(re_ctx, &pc);
+			npush += 1;
+			break;
+		}
+		case DUK_REOP_SPLIT1:
+		case DUK_REOP_SPLIT2: {
+			(void) duk__bc_get_i32(re_ctx, &pc);
+			npush += 2;
+			break;
+		}
+		case DUK_REOP_SQMINIMAL:
+		case DUK_REOP_SQGREEDY: {
+			duk_uint32_t qmin, qmax, qcount;
+
+			qmin = duk__bc_get_u32(re_ctx, &pc);
+			qmax = duk__bc_get_u32(re_ctx, &pc);
+			if (op == DUK_REOP_SQGREEDY) {
+				(void) duk__bc_get_u32(re_ctx, &pc);  /* atomlen */
+			}
+			(void) duk__bc_get_i32(re_ctx, &pc);
+			qcount = (qmax == DUK_RE_QUANTIFIER_INFINITE ? qmin : qmax);
+			if (qcount > maxcount) {
+				maxcount = qcount;
+			}
+			npush += 2;
+			break;
+		}
+		case DUK_REOP_SAVE: {
+			(void) duk__bc_get_u32(re_ctx, &pc);
+			npush += 2;
+			break;
+		}
+		case DUK_REOP_WIPERANGE: {
+			duk_uint32_t idx_count;
+
+			(void) duk__bc_get_u32(re_ctx, &pc);
+			idx_count = duk__bc_get_u32(re_ctx, &pc);
+			if (idx_count > re_ctx->nsaved) {
+				goto internal_error;
+			}
+			npush += (duk_size_t) idx_count + 1;
+			break;
+		}
+		case DUK_REOP_ASSERT_START:
+		case DUK_REOP_ASSERT_END:
+		case DUK_REOP_ASSERT_WORD_BOUNDARY:
+		case DUK_REOP_ASSERT_NOT_WORD_BOUNDARY: {
+			npush += 1;
+			break;
+		}
+		default: {
+			/* Lookaheads and backreferences are not supported;
+			 * such regexps are never flagged for the Pike VM.
+			 */
+			DUK_D(DUK_DPRINT("internal error, regexp opcode not supported by Pike VM: %ld", (long) op));
+			goto internal_error;
+		}
+		}
+	}
+
+	if (maxcount > DUK_RE_PIKEVM_MAX_COUNT) {
+		goto internal_error;
+	}
+
+	*out_nconsume = nconsume;
+	*out_npush = npush;
+	*out_maxcount = maxcount;
+	return;
+
+ internal_error:
+	DUK_ERROR_INTERNAL(re_ctx->thr);
+	DUK_WO_NORETURN(return;);
+}
+
+/* Add thread state (pc, count, sq) and all states reachable from it without
+ * consuming input, at input position 'sp', to 'list' in priority order.
+ * Captures come from pk->saved, which is restored before returning.  If
+ * the final MATCH is reached, the captures are copied to re_ctx->saved and
+ * 1 is returned: the remaining (lower priority) alternatives are abandoned
+ * and pk->saved is left in an arbitrary state.
+ */
+DUK_LOCAL duk_bool_t duk__pike_add(duk__re_pike_ctx *pk, duk__re_pike_list *list, duk_uint32_t pc, duk_uint32_t count, duk_uint32_t sq, const duk_uint8_t *sp) {
+	duk_re_matcher_ctx *re_ctx = pk->re_ctx;
+	duk__re_pike_stackent *ent;
+	duk_size_t top = 0;
+
+#define DUK__PIKE_PUSH(pc_,count_,sq_) do { \
+		if (DUK_UNLIKELY(top >= pk->stack_size)) { \
+			goto internal_error; \
+		} \
+		ent = pk->stack + top++; \
+		ent->st.pc = (pc_); \
+		ent->st.count = (count_); \
+		ent->st.sq = (sq_); \
+	} while (0)
+#define DUK__PIKE_PUSH_RESTORE(idx_) do { \
+		DUK__PIKE_PUSH(DUK__PIKE_RESTORE, (idx_), 0); \
+		ent->ptr = pk->saved[(idx_)]; \
+	} while (0)
+#define DUK__PIKE_PC(p_) ((duk_uint32_t) ((p_) - re_ctx->bytecode))
+
+	DUK__PIKE_PUSH(pc, count, sq);
+
+	while (top > 0) {
+		const duk_uint8_t *p;
+		duk_small_int_t op;
+		duk_size_t key;
+
+		ent = pk->stack + --top;
+		pc = ent->st.pc;
+		count = ent->st.count;
+		sq = ent->st.sq;
+
+		if (pc == DUK__PIKE_RESTORE) {
+			DUK_ASSERT(count < re_ctx->nsaved);
+			pk->saved[count] = ent->ptr;
+			continue;
+		}
+
+		if (pc >= pk->bc_len || count >= pk->ncount) {
+			DUK_D(DUK_DPRINT("internal error, regexp Pike VM state insane: pc=%ld, count=%ld",
+			                 (long) pc, (long) count));
+			goto internal_error;
+		}
+		key = (duk_size_t) pc * pk->ncount + count;
+		if (pk->visited[key] == pk->gen) {
+			continue;
+		}
+		pk->visited[key] = pk->gen;
+		duk__pike_count_step(re_ctx);
+
+		p = re_ctx->bytecode + pc;
+		op = *p++;
+
+		switch (op) {
+		case DUK_REOP_CHAR:
+		case DUK_REOP_PERIOD:
+		case DUK_REOP_RANGES:
+		case DUK_REOP_INVRANGES: {
+			duk__re_pike_thread *t;
+
+			/* Each state is added once per position, so this
+			 * never happens unless the bytecode is broken.
+			 */
+			if (DUK_UNLIKELY(list->count >= pk->list_size)) {
+				goto internal_error;
+			}
+			t = list->threads + list->count;
+			t->pc = pc;
+			t->count = count;
+			t->sq = sq;
+			duk_memcpy((void *) (list->saved + (duk_size_t) list->count * re_ctx->nsaved),
+			           (const void *) pk->saved,
+			           sizeof(const duk_uint8_t *) * re_ctx->nsaved);
+			list->count++;
+			break;
+		}
+		case DUK_REOP_MATCH: {
+			if (sq != DUK__PIKE_NONE) {
+				/* End of simple quantifier atom: continue at the
+				 * quantifier with an updated iteration count.
+				 */
+				const duk_uint8_t *q;
+				duk_uint32_t qmin, qmax;
+
+				q = re_ctx->bytecode + sq + 1;  /* skip opcode */
+				qmin = duk__bc_get_u32(re_ctx, &q);
+				qmax = duk__bc_get_u32(re_ctx, &q);
+				count++;
+				if (qmax == DUK_RE_QUANTIFIER_INFINITE && count > qmin) {
+					count = qmin;
+				}
+				DUK__PIKE_PUSH(sq, count, DUK__PIKE_NONE);
+				break;
+			}
+			duk_memcpy((void *) re_ctx->saved,
+			           (const void *) pk->saved,
+			           sizeof(const duk_uint8_t *) * re_ctx->nsaved);
+			return 1;
+		}
+		case DUK_REOP_JUMP: {
+			duk_int32_t skip;
+
+			skip = duk__bc_get_i32(re_ctx, &p);
+			DUK__PIKE_PUSH(DUK__PIKE_PC(p) + (duk_uint32_t) skip, count, sq);
+			break;
+		}
+		case DUK_REOP_SPLIT1:
+		case DUK_REOP_SPLIT2: {
+			/* Push the preferred alternative last so that it is
+			 * expanded (and its threads added) first.
+			 */
+			duk_int32_t skip;
+
+			skip = duk__bc_get_i32(re_ctx, &p);
+			if (op == DUK_REOP_SPLIT1) {
+				DUK__PIKE_PUSH(DUK__PIKE_PC(p) + (duk_uint32_t) skip, count, sq);
+				DUK__PIKE_PUSH(DUK__PIKE_PC(p), count, sq);
+			} else {
+				DUK__PIKE_PUSH(DUK__PIKE_PC(p), count, sq);
+				DUK__PIKE_PUSH(DUK__PIKE_PC(p) + (duk_uint32_t) skip, count, sq);
+			}
+			break;
+		}
+		case DUK_REOP_SQMINIMAL:
+		case DUK_REOP_SQGREEDY: {
+			duk_uint32_t qmin, qmax;
+			duk_uint32_t atom_pc, sequel_pc;
+			duk_int32_t skip;
+			duk_bool_t can_exit, can_iter;
+
+			qmin = duk__bc_get_u32(re_ctx, &p);
+			qmax = duk__bc_get_u32(re_ctx, &p);
+			if (op == DUK_REOP_SQGREEDY) {
+				(void) duk__bc_get_u32(re_ctx, &p);  /* atomlen */
+			}
+			skip = duk__bc_get_i32(re_ctx, &p);
+			atom_pc = DUK__PIKE_PC(p);
+			sequel_pc = atom_pc + (duk_uint32_t) skip;
+
+			can_exit = (count >= qmin);
+			can_iter = (count < qmax);
+			if (op == DUK_REOP_SQGREEDY) {
+				if (can_exit) {
+					DUK__PIKE_PUSH(sequel_pc, 0, DUK__PIKE_NONE);
+				}
+				if (can_iter) {
+					DUK__PIKE_PUSH(atom_pc, count, pc);
+				}
+			} else {
+				if (can_iter) {
+					DUK__PIKE_PUSH(atom_pc, count, pc);
+				}
+				if (can_exit) {
+					DUK__PIKE_PUSH(sequel_pc, 0, DUK__PIKE_NONE);
+				}
+			}
+			break;
+		}
+		case DUK_REOP_SAVE: {
+			duk_uint32_t idx;
+
+			idx = duk__bc_get_u32(re_ctx, &p);
+			if (idx >= re_ctx->nsaved) {
+				DUK_D(DUK_DPRINT("internal error, regexp save index insane: idx=%ld", (long) idx));
+				goto internal_error;
+			}
+			DUK__PIKE_PUSH_RESTORE(idx);
+			pk->saved[idx] = sp;
+			DUK__PIKE_PUSH(DUK__PIKE_PC(p), count, sq);
+			break;
+		}
+		case DUK_REOP_WIPERANGE: {
+			duk_uint32_t idx_start, idx_count, idx;
+
+			idx_start = duk__bc_get_u32(re_ctx, &p);
+			idx_count = duk__bc_get_u32(re_ctx, &p);
+			if (idx_start + idx_count > re_ctx->nsaved || idx_count == 0) {
+				DUK_D(DUK_DPRINT("internal error, regexp wipe indices insane: idx_start=%ld, idx_count=%ld",
+				                 (long) idx_start, (long) idx_count));
+				goto internal_error;
+			}
+			for (idx = idx_start; idx < idx_start + idx_count; idx++) {
+				DUK__PIKE_PUSH_RESTORE(idx);
+				pk->saved[idx] = NULL;
+			}
+			DUK__PIKE_PUSH(DUK__PIKE_PC(p), count, sq);
+			break;
+		}
+		case DUK_REOP_ASSERT_START:
+		case DUK_REOP_ASSERT_END:
+		case DUK_REOP_ASSERT_WORD_BOUNDARY:
+		case DUK_REOP_ASSERT_NOT_WORD_BOUNDARY: {
+			if (duk__match_assertion(re_ctx, op, sp)) {
+				DUK__PIKE_PUSH(DUK__PIKE_PC(p), count, sq);
+			}
+			break;
+		}
+		default: {
+			DUK_D(DUK_DPRINT("internal error, regexp opcode not supported by Pike VM: %ld", (long) op));
+			goto internal_error;
+		}
+		}
+	}
+
+	return 0;
+
+ internal_error:
+	DUK_ERROR_INTERNAL(re_ctx->thr);
+	DUK_WO_NORETURN(return 0;);
+
+#undef DUK__PIKE_PUSH
+#undef DUK__PIKE_PUSH_RESTORE
+#undef DUK__PIKE_PC
+}
+
+/* Find the leftmost match starting at 'sp' or later.  On a match, captures
+ * are left in re_ctx->saved and '*char_offset' (char offset of 'sp' on entry)
+ * is updated to the start of the match.
+ */
+DUK_LOCAL duk_bool_t duk__match_regexp_pikevm(duk_re_matcher_ctx *re_ctx, const duk_uint8_t *sp, duk_uint32_t *char_offset) {
+	duk_hthread *thr = re_ctx->thr;
+	duk__re_pike_ctx pk;
+	duk__re_pike_list list1, list2;
+	duk__re_pike_list *clist, *nlist, *tmp_list;
+	duk_size_t nconsume, npush;
+	duk_uint32_t maxcount;
+	duk_size_t list_size, nstates;
+	duk_size_t sz_saved, sz_list_saved, sz_stack, sz_list_threads, sz_visited, sz_total;
+	duk_uint8_t *buf;
+	const duk_uint8_t *sp_start;
+	const duk_uint8_t *p;
+	duk_bool_t matched;
+
+	DUK_DD(DUK_DDPRINT("regexp backtracking gave up after %ld steps, rematch with Pike VM",
+	                   (long) re_ctx->steps_count));
+
+	duk__pike_scan(re_ctx, &nconsume, &npush, &maxcount);
+
+	duk_memzero(&pk, sizeof(pk));
+	pk.re_ctx = re_ctx;
+	pk.bc_len = (duk_uint32_t) (re_ctx->bytecode_end - re_ctx->bytecode);
+	pk.ncount = maxcount + 1;
+
+	/* Buffer layout: working captures, list captures (2x), closure stack,
+	 * list threads (2x), visited table.  Pointer aligned parts first.
+	 */
+	nstates = duk__pike_mul(thr, (duk_size_t) pk.bc_len, (duk_size_t) pk.ncount);
+	list_size = duk__pike_mul(thr, nconsume, (duk_size_t) pk.ncount);
+	pk.list_size = list_size;
+	pk.stack_size = duk__pike_mul(thr, npush, (duk_size_t) pk.ncount) + 1;
+	sz_saved = sizeof(const duk_uint8_t *) * (duk_size_t) re_ctx->nsaved;
+	sz_list_saved = duk__pike_mul(thr, list_size, sz_saved);
+	sz_stack = duk__pike_mul(thr, pk.stack_size, sizeof(duk__re_pike_stackent));
+	sz_list_threads = duk__pike_mul(thr, list_size, sizeof(duk__re_pike_thread));
+	sz_visited = duk__pike_mul(thr, nstates, sizeof(duk_uint32_t));
+	sz_total = sz_saved;
+	if (sz_list_saved > (DUK_SIZE_MAX - sz_total) / 2U) {
+		goto too_large;
+	}
+	sz_total += 2U * sz_list_saved;
+	if (sz_stack > DUK_SIZE_MAX - sz_total) {
+		goto too_large;
+	}
+	sz_total += sz_stack;
+	if (sz_list_threads > (DUK_SIZE_MAX - sz_total) / 2U) {
+		goto too_large;
+	}
+	sz_total += 2U * sz_list_threads;
+	if (sz_visited > DUK_SIZE_MAX - sz_total) {
+		goto too_large;
+	}
+	sz_total += sz_visited;
+
+	duk_require_stack(thr, 1);
+	buf = (duk_uint8_t *) duk_push_fixed_buffer_nozero(thr, sz_total);
+	DUK_ASSERT(buf != NULL);
+
+	pk.saved = (const duk_uint8_t **) (void *) buf;
+	buf += sz_saved;
+	list1.saved = (const duk_uint8_t **) (void *) buf;
+	buf += sz_list_saved;
+	list2.saved = (const duk_uint8_t **) (void *) buf;
+	buf += sz_list_saved;
+	pk.stack = (duk__re_pike_stackent *) (void *) buf;
+	buf += sz_stack;
+	list1.threads = (duk__re_pike_thread *) (void *) buf;
+	buf += sz_list_threads;
+	list2.threads = (duk__re_pike_thread *) (void *) buf;
+	buf += sz_list_threads;
+	pk.visited = (duk_uint32_t *) (void *) buf;
+	duk_memzero((void *) pk.visited, sz_visited);
+
+	/* Backtracking budget is spent, the Pike VM is bounded by the
+	 * ordinary step limit.
+	 */
+	re_ctx->steps_limit = DUK_RE_EXECUTE_STEPS_LIMIT;
+
+	clist = &list1;
+	nlist = &list2;
+	clist->count = 0;
+	sp_start = sp;
+
+	pk.gen = 1;
+	duk_memzero((void *) pk.saved, sz_saved);
+	matched = duk__pike_add(&pk, clist, 0, 0, DUK__PIKE_NONE, sp);
+
+	while (sp < re_ctx->input_end && (clist->count > 0 || !matched)) {
+		const duk_uint8_t *sp_next;
+		duk_codepoint_t c;
+		duk_uint32_t i;
+
+		sp_next = sp;
+		c = duk__inp_get_cp(re_ctx, &sp_next);
+		DUK_ASSERT(c >= 0);
+
+		pk.gen++;  /* at most one generation per input byte, cannot wrap */
+		DUK_ASSERT(pk.gen != 0);
+		nlist->count = 0;
+
+		for (i = 0; i < clist->count; i++) {
+			duk__re_pike_thread *t;
+			duk_small_int_t op;
+			duk_bool_t ok;
+
+			duk__pike_count_step(re_ctx);
+
+			t = clist->threads + i;
+			p = re_ctx->bytecode + t->pc;
+			op = *p++;
+			switch (op) {
+			case DUK_REOP_CHAR: {
+				ok = ((duk_codepoint_t) duk__bc_get_u32(re_ctx, &p) == c);
+				break;
+			}
+			case DUK_REOP_PERIOD: {
+				/* E5 Sections 15.10.2.8, 7.3 */
+				ok = !duk_unicode_is_line_terminator(c);
+				break;
+			}
+			case DUK_REOP_RANGES:
+			case DUK_REOP_INVRANGES: {
+				duk_uint32_t n;
+
+				n = duk__bc_get_u32(re_ctx, &p);
+				ok = duk__match_ranges(re_ctx, &p, n, c);
+				if (op == DUK_REOP_INVRANGES) {
+					ok = !ok;
+				}
+				break;
+			}
+			default: {
+				/* Only consuming states are added to thread lists. */
+				DUK_ASSERT(0);
+				ok = 0;
+				break;
+			}
+			}
+			if (!ok) {
+				continue;
+			}
+
+			duk_memcpy((void *) pk.saved,
+			           (const void *) (clist->saved + (duk_size_t) i * re_ctx->nsaved),
+			           sz_saved);
+			if (duk__pike_add(&pk, nlist, (duk_uint32_t) (p - re_ctx->bytecode), t->count, t->sq, sp_next)) {
+				/* Cut off lower priority threads. */
+				matched = 1;
+				break;
+			}
+		}
+
+		if (!matched) {
+			/* New start position, lowest priority. */
+			duk_memzero((void *) pk.saved, sz_saved);
+			matched = duk__pike_add(&pk, nlist, 0, 0, DUK__PIKE_NONE, sp_next);
+		}
+
+		tmp_list = clist;
+		clist = nlist;
+		nlist = tmp_list;
+		sp = sp_next;
+	}
+
+	duk_pop_unsafe(thr);
+
+	if (matched) {
+		/* Match start char offset for the result .index. */
+		DUK_ASSERT(re_ctx->saved[0] != NULL);
+		DUK_ASSERT(re_ctx->saved[0] >= sp_start && re_ctx->saved[0] <= re_ctx->input_end);
+		for (p = sp_start; p < re_ctx->saved[0]; p++) {
+			if ((*p & 0xc0U) != 0x80U) {
+				(*char_offset)++;
+			}
+		}
+	}
+	return matched;
+
+ too_large:
+	DUK_ERROR_RANGE(thr, DUK_STR_BUFFER_TOO_LONG);
+	DUK_WO_NORETURN(return 0;);
+}
+#endif  /* DUK_USE_REGEXP_PIKEVM */
+
 /*
  *  Exposed matcher function which provides the semantics of RegExp.prototype.exec().
  *
@@ -757,6 +1390,19 @@ DUK_LOCAL void duk__regexp_match_helper(duk_hthread *thr, duk_small_int_t force_
 	DUK_ASSERT(re_ctx.nsaved >= 2);
 	DUK_ASSERT((re_ctx.nsaved % 2) == 0);
 
+#if defined(DUK_USE_REGEXP_PIKEVM)
+	if (re_ctx.re_flags & DUK_RE_FLAG_PIKEVM) {
+		/* Limit backtracking to a budget proportional to input length,
+		 * rematch with the Pike VM if exceeded.
+		 */
+		duk_size_t input_blen = (duk_size_t) (re_ctx.input_end - re_ctx.input);
+
+		if (input_blen < (duk_size_t) ((DUK_RE_EXECUTE_STEPS_LIMIT - DUK_RE_PIKEVM_STEPS_BASE) / DUK_RE_PIKEVM_STEPS_PER_BYTE)) {
+			re_ctx.steps_limit = (duk_uint32_t) (DUK_RE_PIKEVM_STEPS_BASE + input_blen * DUK_RE_PIKEVM_STEPS_PER_BYTE);
+		}
+	}
+#endif
+
 	p_buf = (duk_uint8_t *) duk_push_fixed_buffer(thr, sizeof(duk_uint8_t *) * re_ctx.nsaved);  /* rely on zeroing */
 	DUK_UNREF(p_buf);
 	re_ctx.saved = (const duk_uint8_t **) duk_get_buffer(thr, -1, NULL);
@@ -868,6 +1514,16 @@ DUK_LOCAL void duk__regexp_match_helper(duk_hthread *thr, duk_small_int_t force_
 			match = 1;
 			break;
 		}
+#if defined(DUK_USE_REGEXP_PIKEVM)
+		if (re_ctx.pikevm_bailout) {
+			/* Matches starting before char_offset have already
+			 * been ruled out.
+			 */
+			DUK_ASSERT(re_ctx.recursion_depth == 0);
+			match = (duk_small_int_t) duk__match_regexp_pikevm(&re_ctx, sp, &char_offset);
+			break;
+		}
+#endif
 
 		/* advance by one character (code point) and one char_offset */
 		char_offset++;
@@ -0,0 +1,114 @@
+/*
+ *  forEach(), map(), filter(), some(), every(), reduce(), and reduceRight()
+ *  read dense Array elements directly.  Callbacks may modify the Array
+ *  while it's being iterated.
+ */
+
+/*===
+0:a 1:b 2:c
+2,4,6 3
+10 5,6,7 3
+true false false true
+10 abc cba
+map gaps: 5 true false true
+filter gaps: 1,3
+inherited: x,y
+grow: 1,2,3
+shrink: 1,2
+abandon: 0,1,2,3,4,5,6,7,8,9
+reduce shrink: 3 6
+reduce grow: 6
+proto: 1|p1|3
+map big 100000 true
+filter big 33334 true
+done
+===*/
+
+function test() {
+    var a, r, out, i;
+
+    out = [];
+    [ 'a', 'b', 'c' ].forEach(function (v, i, arr) { out.push(i + ':' + v); });
+    print(out.join(' '));
+
+    r = [ 1, 2, 3 ].map(function (v) { return v * 2; });
+    print(r.join(), r.length);
+
+    a = [ 1, 5, 2, 6, 3, 7, 4 ];
+    r = a.filter(function (v) { return v >= 5; });
+    print(a.reduce(function (x, y) { return x + y; }, -18), r.join(), r.length);
+
+    print([ 1, 2, 3 ].some(function (v) { return v === 3; }),
+          [ 1, 2, 3 ].some(function (v) { return v === 4; }),
+          [ 1, 2, 3 ].every(function (v) { return v < 3; }),
+          [ 1, 2, 3 ].every(function (v) { return v < 4; }));
+    print([ 1, 2, 3, 4 ].reduce(function (x, y) { return x + y; }),
+          [ 'a', 'b', 'c' ].reduce(function (x, y) { return x + y; }),
+          [ 'a', 'b', 'c' ].reduceRight(function (x, y) { return x + y; }));
+
+    // Gaps are skipped but preserved by map().
+    a = [ 1, , 3, , ];
+    a.length = 5;
+    r = a.map(function (v) { return v; });
+    print('map gaps:', r.length, 0 in r, 1 in r, 2 in r);
+    r = a.filter(function () { return true; });
+    print('filter gaps:', r.join());
+
+    // Gaps filled by inherited values.
+    Array.prototype[1] = 'y';
+    a = [ 'x', , ];
+    out = [];
+    a.forEach(function (v) { out.push(v); });
+    delete Array.prototype[1];
+    print('inherited:', out.join());
+
+    // Elements added during iteration are not visited, the length is
+    // read once.
+    a = [ 1, 2, 3 ];
+    out = [];
+    a.forEach(function (v) { out.push(v); a.push(v * 10); });
+    print('grow:', out.join());
+
+    // Elements removed during iteration are not visited.
+    a = [ 1, 2, 3, 4 ];
+    out = [];
+    a.forEach(function (v) { out.push(v); if (v === 2) { a.length = 2; } });
+    print('shrink:', out.join());
+
+    // Callback abandons the array part by making the array sparse.
+    a = [];
+    for (i = 0; i < 10; i++) { a.push(i); }
+    out = [];
+    a.forEach(function (v, i) { out.push(v); if (i === 0) { a[1e6] = 'x'; } });
+    print('abandon:', out.join());
+
+    a = [ 1, 2, 3, 4 ];
+    r = a.reduce(function (x, y) { a.length = 2; return x + y; });
+    print('reduce shrink:', r, [ 1, 2, 3 ].reduce(function (x, y) { return x + y; }));
+    a = [ 1, 2, 3 ];
+    r = a.reduce(function (x, y) { a.push(100); return x + y; });
+    print('reduce grow:', r);
+
+    // Prototype getter for a gap.
+    Object.defineProperty(Array.prototype, 1, { get: function () { return 'p1'; }, configurable: true });
+    a = [ 1, , 3 ];
+    print('proto:', a.map(function (v) { return v; }).join('|'));
+    delete Array.prototype[1];
+
+    // Large results: pre-sized map() and compacted filter().
+    a = [];
+    for (i = 0; i < 100000; i++) { a.push(i); }
+    r = a.map(function (v) { return { v: v }; });
+    Duktape.gc();
+    print('map big', r.length, r[99999].v === 99999 && r[0].v === 0);
+    r = a.filter(function (v) { return v % 3 === 0; });
+    print('filter big', r.length, r[33333] === 99999);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
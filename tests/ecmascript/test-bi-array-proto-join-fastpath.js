@@ -0,0 +1,115 @@
+/*
+ *  join() on dense arrays uses a two pass fast path for elements with a
+ *  side effect free string coercion and falls back to the generic path
+ *  otherwise.  Results must be the same in both cases.
+ */
+
+/*===
+basic
+1,2,3
+-1|0|0|4294967295|-4294967295
+4294967296,-4294967296,1.5,NaN,Infinity,-Infinity,1e+21
+true,false,,,foo
+a--b--c
+abc
+x
+
+,
+,,
+unicode
+e4 1234 2028 d83d dca9 2028 78
+large
+20000 868c b
+holes
+a,,c
+a,inherited,c
+coercion
+a,obj,1
+a,sym:TypeError
+locale
+L1,L2
+done
+===*/
+
+function basicTest() {
+    print([1, 2, 3].join());
+    print([-1, 0, -0, 4294967295, -4294967295].join('|'));
+    print([4294967296, -4294967296, 1.5, NaN, 1/0, -1/0, 1e21].join());
+    print([true, false, null, undefined, 'foo'].join());
+    print(['a', 'b', 'c'].join('--'));
+    print(['a', 'b', 'c'].join(''));
+    print(['x'].join('aaa'));
+    print([].join());
+    print([ null, undefined ].join());
+    print([ '', '', '' ].join());
+}
+
+function unicodeTest() {
+    var s = [ '\u00e4\u1234', '\ud83d\udca9', 'x' ].join('\u2028');
+    var res = [];
+    var i;
+    for (i = 0; i < s.length; i++) {
+        res.push(s.charCodeAt(i).toString(16));
+    }
+    print(res.join(' '));
+}
+
+function largeTest() {
+    var arr = [];
+    var i, s;
+    for (i = 0; i < 10000; i++) {
+        arr.push(i % 2 ? 'b' : i);
+    }
+    s = arr.join(':');
+    print(s.split(':').length * 2, s.length.toString(16), s.substring(s.length - 1));
+}
+
+function holesTest() {
+    var arr = [ 'a', , 'c' ];
+    print(arr.join());
+    Array.prototype[1] = 'inherited';
+    try {
+        print(arr.join());
+    } finally {
+        delete Array.prototype[1];
+    }
+}
+
+function coercionTest() {
+    print([ 'a', { toString: function () { return 'obj'; } }, 1 ].join());
+    try {
+        print([ 'a', Symbol('x') ].join());
+    } catch (e) {
+        print('a,sym:' + e.name);
+    }
+}
+
+function localeTest() {
+    var old = Number.prototype.toLocaleString;
+    var count = 0;
+    Number.prototype.toLocaleString = function () { return 'L' + (++count); };
+    try {
+        print([ 1, 2 ].toLocaleString());
+    } finally {
+        Number.prototype.toLocaleString = old;
+    }
+}
+
+try {
+    print('basic');
+    basicTest();
+    print('unicode');
+    unicodeTest();
+    print('large');
+    largeTest();
+    print('holes');
+    holesTest();
+    print('coercion');
+    coercionTest();
+    print('locale');
+    localeTest();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
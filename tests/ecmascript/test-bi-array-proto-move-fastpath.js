@@ -0,0 +1,112 @@
+/*
+ *  shift(), unshift(), splice() and reverse() have fast paths for dense
+ *  Array instances.  Check results, gaps, and fallback cases.
+ */
+
+/*===
+1 [2,3,4] 3
+undefined [] 0
+6 [0,-1,1,2,3,4]
+[2,3] [1,4,5] 3
+[] [1,"a","b",4,5] 5
+[1,4,5,6] [1,6] 2
+[4,3,2,1] true
+[null,1] 2
+queue 2000 1999000
+shift gap: undefined 2 true
+splice gap: 2 false true [0,3]
+reverse gap: [3,null,1] false true
+frozen: TypeError 3
+length nonwritable: TypeError 3
+non-extensible: TypeError 1,2
+side effect: [1,2,null] [9]
+objects ok
+done
+===*/
+
+function test() {
+    var a, r, obj;
+
+    a = [ 1, 2, 3, 4 ];
+    print(a.shift(), JSON.stringify(a), a.length);
+    a = [];
+    print(a.shift(), JSON.stringify(a), a.length);
+    a = [ 1, 2, 3, 4 ];
+    print(a.unshift(0, -1), JSON.stringify(a));
+
+    a = [ 1, 2, 3, 4, 5 ];
+    r = a.splice(1, 2);
+    print(JSON.stringify(r), JSON.stringify(a), a.length);
+    a = [ 1, 2, 3, 4, 5 ];
+    r = a.splice(1, 2, 'a', 'b');
+    print(JSON.stringify(r.slice(0, 0)), JSON.stringify(a), a.length);
+    a = [ 1, 4, 5, 6 ];
+    r = a.splice(-3, 2);
+    print(JSON.stringify([ 1, 4, 5, 6 ]), JSON.stringify(a), r.length);
+
+    a = [ 1, 2, 3, 4 ];
+    print(JSON.stringify(a.reverse()), a.reverse() === a);
+    a = [ 1 ];
+    a.unshift(undefined);
+    print(JSON.stringify(a), a.length);
+
+    // Queue usage.
+    a = [];
+    var sum = 0, i;
+    for (i = 0; i < 2000; i++) {
+        a.push(i);
+        if (i % 2) {
+            sum += a.shift();
+        }
+    }
+    while (a.length > 0) {
+        sum += a.shift();
+    }
+    print('queue', i, sum);
+
+    // Gaps.
+    a = [ , 2, 3 ];
+    print('shift gap:', a.shift(), a.length, 1 in a);
+    a = [ 0, , 2, 3 ];
+    r = a.splice(1, 2);
+    print('splice gap:', r.length, 0 in r, 1 in r, JSON.stringify(a));
+    a = [ 1, , 3 ];
+    a.reverse();
+    print('reverse gap:', JSON.stringify(a), 1 in a, a.hasOwnProperty(2));
+
+    // Fallbacks: frozen, non-writable length, non-extensible.
+    a = Object.freeze([ 1, 2, 3 ]);
+    try { a.shift(); } catch (e) { print('frozen:', e.name, a.length); }
+    a = [ 1, 2, 3 ];
+    Object.defineProperty(a, 'length', { writable: false });
+    try { a.unshift(0); } catch (e) { print('length nonwritable:', e.name, a.length); }
+    a = [ 1, 2 ];
+    Object.preventExtensions(a);
+    try { a.splice(0, 0, 'x'); } catch (e) { print('non-extensible:', e.name, a.join()); }
+
+    // Argument coercion shrinks the array before splicing.
+    a = [ 1, 2, 3, 9 ];
+    obj = { valueOf: function () { a.length = 2; a.push(9); a.length = 3; return 2; } };
+    r = a.splice(obj, 1);
+    print('side effect:', JSON.stringify(a), JSON.stringify(r));
+
+    // Reference counts: moved objects stay reachable.
+    a = [];
+    for (i = 0; i < 100; i++) {
+        a.push({ i: i });
+    }
+    a.reverse();
+    a.splice(10, 20, { i: -1 }, { i: -2 });
+    a.unshift({ i: -3 });
+    a.shift();
+    Duktape.gc();
+    print(a.length === 82 && a[0].i === 99 && a[10].i === -1 && a[81].i === 0 ? 'objects ok' : 'objects fail');
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
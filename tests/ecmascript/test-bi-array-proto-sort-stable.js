@@ -0,0 +1,177 @@
+/*
+ *  Array.prototype.sort() is stable (required since ES2019), both with and
+ *  without a compare function and for dense, sparse, and non-Array inputs.
+ */
+
+/*===
+stable comparefn ok
+stable default ok
+stable object ok
+-1,-10,1,10,100,2,20,3,Infinity,NaN
+a,a,b,b,null,true,3,undefined,undefined, 10
+true 2 false
+5 c,b,a,undefined
+x3,x2,x1
+toString calls ok
+mutating comparefn ok
+Error thrown 3,1,2
+descending ok
+random ok
+done
+===*/
+
+function prng(seed) {
+    return function () {
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+        return seed;
+    };
+}
+
+function checkStable(arr, key) {
+    for (var i = 1; i < arr.length; i++) {
+        if (key(arr[i - 1]) > key(arr[i]) ||
+            (key(arr[i - 1]) === key(arr[i]) && arr[i - 1].idx > arr[i].idx)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+function test() {
+    var rnd = prng(123);
+    var arr, i, calls, obj;
+
+    // Many equal keys, long enough for merges to happen.
+    arr = [];
+    for (i = 0; i < 5000; i++) {
+        arr.push({ key: rnd() % 50, idx: i });
+    }
+    arr.sort(function (a, b) { return a.key - b.key; });
+    print(checkStable(arr, function (v) { return v.key; }) ? 'stable comparefn ok' : 'stable comparefn fail');
+
+    // Default comparison: string keys, equal keys keep order.
+    arr = [];
+    for (i = 0; i < 5000; i++) {
+        arr.push(String(rnd() % 100));
+    }
+    arr = arr.map(function (v, i) { return { toString: function () { return v; }, idx: i, v: v }; });
+    arr.sort();
+    print(checkStable(arr, function (v) { return v.v; }) ? 'stable default ok' : 'stable default fail');
+
+    // Objects with equal keys in a sparse array.
+    arr = [];
+    for (i = 0; i < 300; i++) {
+        arr[i * 2] = { key: i % 3, idx: i };
+    }
+    arr.sort(function (a, b) { return a.key - b.key; });
+    print(checkStable(arr.slice(0, 300), function (v) { return v.key; }) && arr.length === 599 && !(300 in arr) ?
+          'stable object ok' : 'stable object fail');
+
+    // Default sort of numbers compares strings.
+    print([ 3, 20, 100, 2, 1, -1, 10, NaN, -10, Infinity ].sort().join());
+
+    // Mixed types: undefined last, then gaps.
+    arr = [ 'b', undefined, 3, null, true, , 'a', 'b', undefined, 'a' ];
+    arr.sort(function (a, b) {
+        var x = typeof a === 'number' ? 1 : 0, y = typeof b === 'number' ? 1 : 0;
+        if (x !== y) { return x - y; }
+        if (x) { return 0; }
+        return String(a) < String(b) ? -1 : (String(a) > String(b) ? 1 : 0);
+    });
+    print(arr.map(String).join(), arr.length);
+    print(8 in arr, arr.length - 8, 9 in arr);
+
+    // Non-Array object.
+    obj = { 0: 'b', 2: 'c', 3: undefined, 4: 'a', length: 5 };
+    Array.prototype.sort.call(obj, function (a, b) { return a < b ? 1 : -1; });
+    print(obj.length, [ obj[0], obj[1], obj[2], obj[3] ].map(String).join());
+
+    // Inherited values fill gaps.
+    Array.prototype[1] = 'x2';
+    arr = [ 'x3', , 'x1' ];
+    arr.sort().reverse();
+    delete Array.prototype[1];
+    print(arr.join());
+
+    // Objects are coerced for every comparison, primitives need no
+    // coercion calls at all.
+    calls = 0;
+    arr = [];
+    for (i = 0; i < 10; i++) {
+        arr.push({ toString: function () { calls++; return 'z'; } });
+        arr.push(i);
+    }
+    arr.sort();
+    print(calls >= 10 && arr[0] === 0 && arr[19].toString() === 'z' ? 'toString calls ok' : 'toString calls fail');
+
+    // Compare function modifying the array: must not crash, and the
+    // result is a permutation of the original values.
+    arr = [];
+    for (i = 0; i < 200; i++) {
+        arr.push(i);
+    }
+    arr.sort(function (a, b) {
+        arr.length = 0;
+        arr.push('junk');
+        Duktape.gc();
+        return b - a;
+    });
+    print(arr.length === 200 && arr[0] === 199 && arr[199] === 0 ? 'mutating comparefn ok' : 'mutating comparefn fail');
+
+    // Errors propagate, array is left untouched.
+    arr = [ 3, 1, 2 ];
+    try {
+        arr.sort(function () { throw new Error('aiee'); });
+    } catch (e) {
+        print(e.name, 'thrown', arr.join());
+    }
+
+    // Descending and ascending runs.
+    arr = [];
+    for (i = 0; i < 1000; i++) {
+        arr.push(1000 - i);
+    }
+    for (i = 0; i < 1000; i++) {
+        arr.push(i);
+    }
+    arr.sort(function (a, b) { return a - b; });
+    calls = true;
+    for (i = 1; i < arr.length; i++) {
+        if (arr[i - 1] > arr[i]) { calls = false; }
+    }
+    print(calls ? 'descending ok' : 'descending fail');
+
+    // Random arrays of various sizes against a simple insertion sort.
+    calls = true;
+    [ 0, 1, 2, 3, 31, 32, 33, 63, 64, 65, 100, 257, 1000 ].forEach(function (n) {
+        var a = [], b, j, k, t;
+        for (j = 0; j < n; j++) {
+            a.push(rnd() % 100);
+        }
+        b = a.slice();
+        for (j = 1; j < b.length; j++) {
+            t = b[j];
+            for (k = j - 1; k >= 0 && b[k] > t; k--) {
+                b[k + 1] = b[k];
+            }
+            b[k + 1] = t;
+        }
+        a.sort(function (x, y) { return x - y; });
+        if (a.join() !== b.join()) {
+            calls = false;
+        }
+        a.sort();
+        if (a.join() !== b.map(String).sort().join()) {
+            calls = false;
+        }
+    });
+    print(calls ? 'random ok' : 'random fail');
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
@@ -0,0 +1,131 @@
+/*
+ *  JSON.parse() string decoding scans plain byte runs a word at a time.
+ *  Place string terminators, escapes, control characters, and the end of
+ *  input at every offset relative to word boundaries.
+ */
+
+/*===
+quote ok
+escape ok
+control ok
+unterminated ok
+non-bmp ok
+done
+===*/
+
+function pad(n) {
+    var res = '';
+    while (res.length < n) {
+        res += 'abcdefghijklmnopqrstuvwxyz'.charAt(res.length % 26);
+    }
+    return res;
+}
+
+function expectError(txt) {
+    try {
+        JSON.parse(txt);
+        return false;
+    } catch (e) {
+        return e.name === 'SyntaxError';
+    }
+}
+
+function quoteTest() {
+    var lead, len, s, ok = true;
+
+    // Vary both the string start offset and the string length.
+    for (lead = 0; lead < 8; lead++) {
+        for (len = 0; len < 40; len++) {
+            s = pad(len);
+            if (JSON.parse(pad(lead).replace(/./g, ' ') + '"' + s + '"') !== s) {
+                ok = false;
+            }
+            if (JSON.parse('["' + pad(lead) + '","' + s + '"]')[1] !== s) {
+                ok = false;
+            }
+        }
+    }
+    print(ok ? 'quote ok' : 'quote fail');
+}
+
+function escapeTest() {
+    var escs = [ [ '\\\\', '\\' ], [ '\\"', '"' ], [ '\\n', '\n' ], [ '\\u00e4', 'ä' ], [ '\\/', '/' ] ];
+    var pos, len, i, ok = true;
+
+    for (i = 0; i < escs.length; i++) {
+        for (len = 1; len < 24; len++) {
+            for (pos = 0; pos <= len; pos++) {
+                if (JSON.parse('"' + pad(pos) + escs[i][0] + pad(len - pos) + '"') !== pad(pos) + escs[i][1] + pad(len - pos)) {
+                    ok = false;
+                }
+            }
+        }
+    }
+
+    // Long string with sparse escapes.
+    var src = '', exp = '';
+    for (i = 0; i < 500; i++) {
+        src += pad(i % 37) + '\\t';
+        exp += pad(i % 37) + '\t';
+    }
+    if (JSON.parse('"' + src + '"') !== exp) {
+        ok = false;
+    }
+
+    print(ok ? 'escape ok' : 'escape fail');
+}
+
+function controlTest() {
+    var pos, len, cc, ok = true;
+
+    for (cc = 0; cc < 0x20; cc++) {
+        for (len = 1; len < 12; len++) {
+            for (pos = 0; pos < len; pos++) {
+                if (!expectError('"' + pad(pos) + String.fromCharCode(cc) + pad(len - pos) + '"')) {
+                    ok = false;
+                }
+            }
+        }
+    }
+
+    // 0x7f and non-ASCII are allowed as is.
+    if (JSON.parse('"a\u007fbÿሴc"') !== 'a\u007fbÿሴc') {
+        ok = false;
+    }
+    print(ok ? 'control ok' : 'control fail');
+}
+
+function unterminatedTest() {
+    var len, ok = true;
+
+    for (len = 0; len < 40; len++) {
+        if (!expectError('"' + pad(len))) {
+            ok = false;
+        }
+        if (!expectError('"' + pad(len) + '\\')) {
+            ok = false;
+        }
+        if (!expectError('["' + pad(len) + '\\n')) {
+            ok = false;
+        }
+    }
+    print(ok ? 'unterminated ok' : 'unterminated fail');
+}
+
+function nonBmpTest() {
+    var s = '😀' + pad(13) + '€' + pad(5) + '😀';
+    var v = JSON.parse('{"' + s + '":"' + s + '"}');
+    print(v[s] === s ? 'non-bmp ok' : 'non-bmp fail');
+}
+
+try {
+    quoteTest();
+    escapeTest();
+    controlTest();
+    unterminatedTest();
+    nonBmpTest();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
@@ -0,0 +1,120 @@
+/*
+ *  Map basic behavior: SameValueZero keys without string coercion,
+ *  insertion order, and growth/compaction of the hash table.
+ */
+
+/*===
+function 0 Map
+[object Map]
+4 a b z z n false
+obj undefined
+true true false
+true false 4
+[1,0,null,{},"1"]
+number number number object string
+0
+growth ok
+order ok
+TypeError
+TypeError
+undefined undefined
+done
+===*/
+
+function basicTest() {
+    var m, o;
+
+    print(typeof Map, Map.length, Map.name);
+    m = new Map();
+    print(Object.prototype.toString.call(m));
+
+    m.set(1, 'a').set('1', 'b').set(-0, 'z').set(NaN, 'n');
+    print(m.size, m.get(1), m.get('1'), m.get(0), m.get(+0), m.get(NaN), m.has(2));
+
+    o = {};
+    m.set(o, 'obj');
+    print(m.get(o), m.get({}));
+
+    print(m.has(1), m['delete']('1'), m['delete']('1'));
+    print(m.has(-0), m.has(undefined), m.size);
+
+    m.set(1, 'c');  // update keeps position
+    m.set('1', 'd');
+    print(JSON.stringify(arrayFrom(m.keys())));
+    print(arrayFrom(m.keys()).map(function (k) { return typeof k; }).join(' '));
+
+    m.clear();
+    print(m.size);
+}
+
+function arrayFrom(it) {
+    var res = [], r;
+    while (!(r = it.next()).done) {
+        res.push(r.value);
+    }
+    return res;
+}
+
+function growthTest() {
+    var m = new Map();
+    var keys = [], i, ok = true;
+
+    // Mixed key types, including objects and numbers that would collide
+    // when coerced to strings.
+    for (i = 0; i < 5000; i++) {
+        keys.push(i % 3 === 0 ? { id: i } : (i % 3 === 1 ? i : String(i)));
+    }
+    keys.forEach(function (k, i) { m.set(k, i); });
+    if (m.size !== 5000) { ok = false; }
+    keys.forEach(function (k, i) {
+        if (m.get(k) !== i) { ok = false; }
+    });
+
+    // Delete most entries and re-add, exercising compaction.
+    for (i = 0; i < 5000; i++) {
+        if (i % 5 !== 0) {
+            if (!m['delete'](keys[i])) { ok = false; }
+        }
+    }
+    if (m.size !== 1000) { ok = false; }
+    for (i = 0; i < 3000; i++) {
+        m.set(-i - 1, i);
+    }
+    if (m.size !== 4000 || m.get(-3000) !== 2999 || m.has(keys[1]) || m.get(keys[5]) !== 5) { ok = false; }
+    print(ok ? 'growth ok' : 'growth fail');
+
+    // Iteration order is insertion order across compaction.
+    var prev = -1, order = true;
+    m.forEach(function (v, k) {
+        if (typeof k === 'number' && k < 0) {
+            if (v <= prev) { order = false; }
+            prev = v;
+        }
+    });
+    print(order ? 'order ok' : 'order fail');
+}
+
+function errorTest() {
+    try {
+        Map();
+    } catch (e) {
+        print(e.name);
+    }
+    try {
+        Map.prototype.get.call({}, 1);
+    } catch (e) {
+        print(e.name);
+    }
+    var m = new Map([[ 1, 2 ]]);
+    print(Map.prototype.get.call(m, 2), new Map(null).get(1));
+}
+
+try {
+    basicTest();
+    growthTest();
+    errorTest();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
@@ -0,0 +1,145 @@
+/*
+ *  Map and Set iterators and forEach() see entries added during iteration,
+ *  skip deleted ones, and stay in sync when the table is compacted.
+ */
+
+/*===
+[object Map Iterator] [object Set Iterator]
+true
+1,2,3,4,5,6,7,8,9,10
+0,1,2,3,4
+after clear: x,y
+{"done":true} {"done":true}
+compaction ok
+foreach ok
+done
+===*/
+
+function collect(it) {
+    var res = [], r;
+    while (!(r = it.next()).done) {
+        res.push(r.value);
+    }
+    return res;
+}
+
+function test() {
+    var m, s, it, res, r, i;
+
+    m = new Map([[ 1, 'a' ]]);
+    s = new Set([ 1 ]);
+    print(Object.prototype.toString.call(m.keys()), Object.prototype.toString.call(s.values()));
+    it = m.keys();
+    print(it[Symbol.iterator]() === it);
+
+    // Entries added during iteration are visited.
+    s = new Set([ 1 ]);
+    res = [];
+    it = s.values();
+    while (!(r = it.next()).done) {
+        res.push(r.value);
+        if (r.value < 10) {
+            s.add(r.value + 1);
+        }
+    }
+    print(res.join());
+
+    // Deleting entries ahead of the iterator skips them.
+    s = new Set();
+    for (i = 0; i < 10; i++) { s.add(i); }
+    res = [];
+    it = s.values();
+    while (!(r = it.next()).done) {
+        res.push(r.value);
+        if (r.value === 4) {
+            for (i = 5; i < 10; i++) { s['delete'](i); }
+        }
+    }
+    print(res.join());
+
+    // clear() during iteration, then add.
+    m = new Map([[ 1, 1 ], [ 2, 2 ]]);
+    it = m.keys();
+    it.next();
+    m.clear();
+    m.set('x', 1).set('y', 2);
+    print('after clear: ' + collect(it).join());
+
+    // Exhausted iterators stay exhausted.
+    m.set('z', 3);
+    print(JSON.stringify(it.next()), JSON.stringify(it.next()));
+}
+
+function compactionTest() {
+    var m = new Map(), iters = [], expect = [], ok = true, i, j, r;
+
+    for (i = 0; i < 100; i++) {
+        m.set(i, i);
+    }
+
+    // Iterators at various positions, then delete and add enough entries
+    // to force several compactions.
+    for (i = 0; i < 10; i++) {
+        iters.push(m.values());
+        for (j = 0; j < i * 10; j++) {
+            iters[i].next();
+        }
+    }
+    for (i = 0; i < 100; i += 2) {
+        m['delete'](i);
+    }
+    for (i = 100; i < 2000; i++) {
+        m.set(i, i);
+        if (i % 3 === 0) {
+            m['delete'](i);
+        }
+    }
+    for (i = 0; i < 10; i++) {
+        r = iters[i].next();
+        // Next live entry at or after position i * 10.
+        j = i * 10;
+        if (j % 2 === 0) { j++; }
+        if (r.value !== j) {
+            print('iterator', i, 'got', r.value, 'expected', j);
+            ok = false;
+        }
+    }
+    print(ok ? 'compaction ok' : 'compaction fail');
+}
+
+function forEachTest() {
+    var m = new Map(), seen = [], ok = true, i;
+
+    for (i = 0; i < 50; i++) {
+        m.set('k' + i, i);
+    }
+    m.forEach(function (v, k, map) {
+        seen.push(v);
+        if (v < 50) {
+            // Delete an earlier entry, add a later one: lots of churn.
+            map['delete']('k' + (v - 1));
+            map.set('n' + v, v + 50);
+        }
+        if (v === 10) {
+            for (var j = 0; j < 500; j++) {
+                map.set(j, j);
+                map['delete'](j);
+            }
+        }
+    }, null);
+    for (i = 0; i < 100; i++) {
+        if (seen[i] !== i) { ok = false; }
+    }
+    if (seen.length !== 100 || m.size !== 51) { ok = false; }
+    print(ok ? 'foreach ok' : 'foreach fail');
+}
+
+try {
+    test();
+    compactionTest();
+    forEachTest();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
@@ -1,9 +1,3 @@
-/*---
-{
-    "skip": true
-}
----*/
-
 /*===
 done
 all reject: Error: aiee
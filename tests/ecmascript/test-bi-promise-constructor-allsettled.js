@@ -0,0 +1,38 @@
+/*===
+done
+fulfilled 123
+rejected RangeError: aiee
+fulfilled thenable
+length 3
+===*/
+
+var resolve1, reject2;
+
+var P1 = new Promise(function (resolve, reject) {
+    resolve1 = resolve;
+});
+var P2 = new Promise(function (resolve, reject) {
+    reject2 = reject;
+});
+var T3 = {
+    then: function (resolve, reject) {
+        // Calling both is harmless, only the first call counts.
+        resolve('thenable');
+        reject(new Error('ignored'));
+    }
+};
+
+Promise.allSettled([ P1, P2, T3 ]).then(function (v) {
+    v.forEach(function (res) {
+        print(res.status, res.status === 'fulfilled' ? res.value : String(res.reason));
+    });
+    print('length', v.length);
+}, function (e) {
+    print('never here:', e);
+});
+
+// Rejection doesn't short circuit .allSettled(), unlike .all().
+reject2(new RangeError('aiee'));
+resolve1(123);
+
+print('done');
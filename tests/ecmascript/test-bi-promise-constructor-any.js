@@ -0,0 +1,28 @@
+/*===
+done
+any empty: Error 0
+any fulfill: 2
+any reject: Error 1,2 false
+===*/
+
+Promise.any([ Promise.reject(1), Promise.resolve(2), Promise.resolve(3) ]).then(function (v) {
+    print('any fulfill:', v);
+}, function (e) {
+    print('never here:', e);
+});
+
+// Duktape lacks AggregateError; the rejection reason is an Error with
+// a non-enumerable 'errors' array.
+Promise.any([]).then(function (v) {
+    print('never here:', v);
+}, function (e) {
+    print('any empty:', e.name, e.errors.length);
+});
+
+Promise.any([ Promise.reject(1), Promise.reject(2) ]).then(function (v) {
+    print('never here:', v);
+}, function (e) {
+    print('any reject:', e.name, e.errors, Object.keys(e).indexOf('errors') >= 0);
+});
+
+print('done');
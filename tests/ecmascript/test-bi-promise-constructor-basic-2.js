@@ -1,9 +1,3 @@
-/*---
-{
-    "skip": true
-}
----*/
-
 /*===
 - step 10
 executor called
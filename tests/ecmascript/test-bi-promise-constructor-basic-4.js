@@ -1,9 +1,3 @@
-/*---
-{
-    "skip": true
-}
----*/
-
 /*===
 - resolve() may be given a Promise
 done
@@ -9,12 +9,6 @@
 //                             |
 //                             P
 
-/*---
-{
-    "skip": true
-}
----*/
-
 /*===
 done
 A 123
@@ -2,12 +2,6 @@
  *  Mandelbrot rendered as a lot of individual Promises.
  */
 
-/*---
-{
-    "skip": true
-}
----*/
-
 /*===
 ..........................,,,,,,,,,,,,,,,,,,,,,,,,,.........................
 ....................,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,...................
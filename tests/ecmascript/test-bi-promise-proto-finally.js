@@ -0,0 +1,45 @@
+/*===
+done
+finally 1 0
+finally 2
+finally 3
+finally 4
+reject: override
+fulfill: 123
+reject: 234
+fulfill: 345
+===*/
+
+// The onFinally return value is ignored unless it throws or rejects.
+Promise.resolve(123).finally(function () {
+    print('finally 1', arguments.length);
+    return 999;
+}).then(function (v) {
+    print('fulfill:', v);
+});
+
+Promise.reject(234).finally(function () {
+    print('finally 2');
+}).then(function (v) {
+    print('never here:', v);
+}, function (e) {
+    print('reject:', e);
+});
+
+Promise.resolve(0).finally(function () {
+    print('finally 3');
+    throw 'override';
+}).then(function (v) {
+    print('never here:', v);
+}, function (e) {
+    print('reject:', e);
+});
+
+Promise.resolve(345).finally(function () {
+    print('finally 4');
+    return Promise.resolve(999);
+}).then(function (v) {
+    print('fulfill:', v);
+});
+
+print('done');
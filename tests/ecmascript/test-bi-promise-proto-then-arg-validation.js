@@ -2,12 +2,6 @@
 // they will behave the same as a missing value with no TypeError.
 // https://www.ecma-international.org/ecma-262/6.0/#sec-performpromisethen
 
-/*---
-{
-    "skip": true
-}
----*/
-
 /*===
 done
 P fulfill 1 123
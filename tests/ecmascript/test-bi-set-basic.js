@@ -0,0 +1,62 @@
+/*
+ *  Set basic behavior.
+ */
+
+/*===
+function 0 Set
+[object Set]
+5
+1 1 true
+2 2 true
+3 3 true
+3 3 true
+NaN NaN true
+true true false
+true true
+[1,1]
+true false true 0
+3 abc
+done
+===*/
+
+function test() {
+    var s, o, it;
+
+    print(typeof Set, Set.length, Set.name);
+    s = new Set([ 1, 2, 2, 3, '3', NaN, NaN ]);
+    print(Object.prototype.toString.call(s));
+    print(s.size);
+    s.forEach(function (v, k, set) {
+        print(v, k, set === s);
+    });
+
+    o = {};
+    print(s.add(o) === s, s.has(o), s.has({}));
+    print(Set.prototype.keys === Set.prototype.values,
+          Set.prototype[Symbol.iterator] === Set.prototype.values);
+
+    it = s.entries();
+    print(JSON.stringify(it.next().value));
+
+    print(s['delete'](o), s['delete'](o), s.has(NaN), (s.clear(), s.size));
+
+    // Array-like source (strings have no @@iterator here).
+    s = new Set('abcab');
+    print(s.size, Array.prototype.join.call(arrayFrom(s.values()), ''));
+}
+
+function arrayFrom(it) {
+    var res = [], r;
+    while (!(r = it.next()).done) {
+        res.push(r.value);
+    }
+    return res;
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
@@ -17,7 +17,7 @@
 float double test
 0 -Infinity -Infinity
 1 -9007199254740994 -9007199254740992
-2 -9007199254740994 -9007199254740992
+2 -9007199254740992 -9007199254740992
 3 -9007199254740992 -9007199254740992
 4 -9007199254740991 -9007199254740992
 5 -9007199254740990 -9007199254740992
@@ -48,7 +48,7 @@ float double test
 30 9007199254740990 9007199254740992
 31 9007199254740991 9007199254740992
 32 9007199254740992 9007199254740992
-33 9007199254740994 9007199254740992
+33 9007199254740992 9007199254740992
 34 9007199254740994 9007199254740992
 35 Infinity Infinity
 36 NaN NaN
@@ -0,0 +1,76 @@
+/*
+ *  WeakMap and WeakSet basic behavior.
+ */
+
+/*===
+function 0 WeakMap function 0 WeakSet
+[object WeakMap] [object WeakSet]
+1 2 true
+true false undefined
+true 0 0
+TypeError
+false undefined false
+independent ok
+true false true
+TypeError
+gc ok
+done
+===*/
+
+function test() {
+    var wm, wm2, ws, k1, k2, f;
+
+    print(typeof WeakMap, WeakMap.length, WeakMap.name, typeof WeakSet, WeakSet.length, WeakSet.name);
+    wm = new WeakMap();
+    ws = new WeakSet();
+    print(Object.prototype.toString.call(wm), Object.prototype.toString.call(ws));
+
+    k1 = {};
+    k2 = Object.freeze({});
+    f = function () {};
+    print(wm.set(k1, 1).set(k2, 2).get(k1), wm.get(k2), wm.has(k2));
+    print(wm['delete'](k1), wm.has(k1), wm.get(k1));
+
+    // Entries are invisible on the key object.
+    print(Object.isFrozen(k2), Object.getOwnPropertySymbols(k2).length, Object.getOwnPropertyNames(k2).length);
+
+    try {
+        wm.set('foo', 1);
+    } catch (e) {
+        print(e.name);
+    }
+    print(wm.has(1), wm.get(null), wm['delete'](f));
+
+    // Separate instances don't share entries.
+    wm2 = new WeakMap([[ k2, 'other' ]]);
+    print(wm.get(k2) === 2 && wm2.get(k2) === 'other' ? 'independent ok' : 'independent fail');
+
+    ws = new WeakSet([ k1, f ]);
+    print(ws.has(k1), ws.has(k2), ws.has(f));
+    try {
+        WeakSet.prototype.has.call(wm, k1);
+    } catch (e) {
+        print(e.name);
+    }
+}
+
+function gcTest() {
+    var wm = new WeakMap(), i, k;
+
+    // Values are released with their keys.
+    for (i = 0; i < 1000; i++) {
+        k = { i: i };
+        wm.set(k, { big: new Array(100).join('x') });
+    }
+    Duktape.gc();
+    print(wm.get(k).big.length === 99 ? 'gc ok' : 'gc fail');
+}
+
+try {
+    test();
+    gcTest();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
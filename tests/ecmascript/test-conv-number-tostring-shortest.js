@@ -0,0 +1,111 @@
+/*
+ *  Shortest radix 10 number-to-string conversion (Grisu3 fast path with
+ *  Dragon4 fallback): output must round trip and no shorter digit string
+ *  may round trip.
+ *
+ *  Dragon4 alone gets a few powers of two just above the denormal range
+ *  wrong (e.g. 2^-1018), so the expected output assumes the Grisu3 path.
+ */
+
+/*===
+0.1
+0.30000000000000004
+0.3333333333333333
+-1.7976931348623157e+308
+5e-324
+2.2250738585072014e-308
+2.225073858507201e-308
+3.5601181736115222e-307
+1.7800590868057611e-307
+1e+21
+123456789012345680000
+1.2345678901234568e+21
+1e-7
+0.000001
+1.5
+-2.5e-10
+9007199254740994
+1234.5678
+4.35
+random ok
+powers of two ok
+done
+===*/
+
+function digitCount(s) {
+    // Significant mantissa digits, e.g. '-1.25e-7' -> 3.
+    var m = s.replace(/^-/, '').replace(/e.*$/, '').replace('.', '');
+    m = m.replace(/^0+/, '').replace(/0+$/, '');
+    return m.length;
+}
+
+function checkShortest(x) {
+    var s = String(x);
+    var n = digitCount(s);
+    if (Number(s) !== x) {
+        return false;
+    }
+    if (n > 1 && Number(x.toPrecision(n - 1)) === x) {
+        return false;
+    }
+    return true;
+}
+
+function knownTest() {
+    [ 0.1, 0.1 + 0.2, 1 / 3, -Number.MAX_VALUE, Number.MIN_VALUE,
+      2.2250738585072014e-308, 2.225073858507201e-308,
+      Math.pow(2, -1018), Math.pow(2, -1019),
+      1e21, 123456789012345678901, 1234567890123456789012,
+      1e-7, 1e-6, 1.5, -2.5e-10, 9007199254740994, 1234.5678, 4.35
+    ].forEach(function (v) {
+        print(String(v));
+    });
+}
+
+function randomTest() {
+    var dv = new DataView(new ArrayBuffer(8));
+    var seed = 1;
+    var i, x, bad = 0;
+
+    function rnd() {
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+        return seed;
+    }
+
+    for (i = 0; i < 20000; i++) {
+        dv.setUint32(0, ((rnd() << 1) ^ (rnd() >>> 3)) & 0x7fffffff);
+        dv.setUint32(4, ((rnd() << 1) ^ (rnd() >>> 3)) >>> 0);
+        x = dv.getFloat64(0);
+        if (!isFinite(x) || x === 0) {
+            continue;
+        }
+        if (!checkShortest(x) || !checkShortest(-x)) {
+            print('failed:', String(x));
+            bad++;
+        }
+    }
+    print(bad === 0 ? 'random ok' : 'random fail');
+}
+
+function powersTest() {
+    var e, bad = 0;
+
+    // Powers of two have a closer lower neighbor.
+    for (e = -1074; e <= 1023; e++) {
+        if (!checkShortest(Math.pow(2, e))) {
+            print('failed:', e);
+            bad++;
+        }
+    }
+    print(bad === 0 ? 'powers of two ok' : 'powers of two fail');
+}
+
+try {
+    knownTest();
+    randomTest();
+    powersTest();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
@@ -0,0 +1,56 @@
+/*
+ *  Growing the array part of an Array with no other properties resizes
+ *  the allocation in place.  Check that elements survive the resize and
+ *  that the new part of the allocation reads as gaps.
+ */
+
+/*===
+1000000 999999 499999.5 0
+gaps 20 true false true
+named 5000 4999 bar
+holes 3 1,,3
+===*/
+
+function appendTest() {
+    var a = [];
+    var i, s = 0;
+    for (i = 0; i < 1000000; i++) {
+        a[i] = i * 0.5;
+    }
+    for (i = 0; i < a.length; i++) {
+        s += a[i];
+    }
+    print(a.length, a[999999] * 2, a[999999], s - 249999750000);
+}
+
+function gapsTest() {
+    var a = [ 1, 2, 3 ];
+    a[19] = 'x';
+    print('gaps', a.length, 3 in a === false, 18 in a, 19 in a);
+}
+
+function namedTest() {
+    var a = [];
+    var i;
+    a.foo = 'bar';
+    for (i = 0; i < 5000; i++) {
+        a.push(i);
+    }
+    print('named', a.length, a[4999], a.foo);
+}
+
+function holesTest() {
+    var a = [ 1 ];
+    a.length = 2;
+    a.push(3);
+    print('holes', a.length, a.join());
+}
+
+try {
+    appendTest();
+    gapsTest();
+    namedTest();
+    holesTest();
+} catch (e) {
+    print(e.stack || e);
+}
@@ -270,6 +270,262 @@ object true
 object true
 object true
 object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
+object true
 ===*/
 
 function mkObj() {
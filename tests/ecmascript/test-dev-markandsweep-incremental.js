@@ -0,0 +1,125 @@
+/*
+ *  Mutate a live object graph heavily while creating lots of cyclic
+ *  garbage, so that voluntary mark-and-sweep runs in the middle of the
+ *  mutations.  With DUK_USE_INCREMENTAL_GC this exercises the write
+ *  barrier (property, array, register and value stack writes, values
+ *  moved between threads by yield/resume) and objects and strings
+ *  created while a cycle is in progress.  Without it this is just a
+ *  GC stress test; the output is the same.
+ */
+
+/*---
+{
+    "custom": true
+}
+---*/
+
+/*===
+graph ok
+strings ok
+thread ok
+finalized: true
+done
+===*/
+
+var finalized = 0;
+
+function makeGarbage(n) {
+    var i, g;
+    for (i = 0; i < n; i++) {
+        g = { idx: i };
+        g.self = g;
+        if ((i & 1023) === 0) {
+            Duktape.fin(g, function () { finalized++; });
+        }
+    }
+}
+
+function graphTest() {
+    var nodes = [];
+    var i, j, n, tmp;
+
+    for (i = 0; i < 2000; i++) {
+        nodes.push({ id: i, next: null, data: [ i ] });
+    }
+
+    // Rewire the graph repeatedly so that references move from objects
+    // not yet scanned to objects already scanned.
+    for (j = 0; j < 40; j++) {
+        for (i = 0; i < nodes.length; i++) {
+            n = nodes[i];
+            tmp = nodes[(i * 7 + j) % nodes.length];
+            n.next = tmp.next || { id: -1, next: null, data: [ 'fresh' + j ] };
+            tmp.next = null;
+            n.data.push(n.data.shift());
+        }
+        makeGarbage(2000);
+    }
+
+    for (i = 0; i < nodes.length; i++) {
+        n = nodes[i];
+        if (n.id !== i || n.data.length !== 1 || n.data[0] !== i) {
+            throw new Error('node ' + i + ' corrupted');
+        }
+        if (n.next !== null && n.next.data.length !== 1) {
+            throw new Error('next of node ' + i + ' corrupted');
+        }
+    }
+    print('graph ok');
+}
+
+function stringTest() {
+    var keep = {};
+    var i, k;
+
+    // Strings interned (and re-interned) while a cycle is in progress.
+    for (i = 0; i < 50000; i++) {
+        k = 'key-' + (i % 5000);
+        keep[k] = (keep[k] || 0) + 1;
+        if ((i & 255) === 0) {
+            makeGarbage(500);
+        }
+    }
+    for (i = 0; i < 5000; i++) {
+        if (keep['key-' + i] !== 10) {
+            throw new Error('string key ' + i + ' corrupted');
+        }
+    }
+    print('strings ok');
+}
+
+function threadTest() {
+    var t = new Duktape.Thread(function (v) {
+        var held = [];
+        for (;;) {
+            held.push(v);
+            makeGarbage(300);
+            v = Duktape.Thread.yield(held.length > 10 ? held.shift() : null);
+        }
+    });
+    var i, r, expect = 0;
+
+    for (i = 0; i < 500; i++) {
+        r = Duktape.Thread.resume(t, { v: i, s: 'val' + i });
+        if (r !== null) {
+            if (r.v !== expect || r.s !== 'val' + expect) {
+                throw new Error('thread value ' + expect + ' corrupted');
+            }
+            expect++;
+        }
+    }
+    print('thread ok');
+}
+
+try {
+    graphTest();
+    stringTest();
+    threadTest();
+    Duktape.gc();
+    Duktape.gc();
+    print('finalized:', finalized > 0);
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
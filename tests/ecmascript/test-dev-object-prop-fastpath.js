@@ -0,0 +1,192 @@
+/*
+ *  Plain data property reads and writes with a string key go through an
+ *  entry part fast path (DUK_USE_OBJECT_PROP_FASTPATH) when possible.
+ *  Exercise cases where the fast path must not apply or must fall back to
+ *  the full algorithm, and check that results match the standard behavior.
+ */
+
+/*===
+own and inherited
+1 2 3 undefined
+shadowing
+own-b
+accessor in chain
+getter this: true
+setter called: 123
+undefined
+non-writable
+TypeError
+1
+inherited non-writable
+TypeError
+false
+frozen
+TypeError
+1
+proxy
+get trap: foo
+proxied
+set trap: foo
+1
+arguments
+10 11
+20 11
+string base
+string
+6 o
+overridden: xyz
+symbol key
+symval
+large object
+199 undefined
+delete and re-add
+undefined 2
+===*/
+
+function ownAndInherited() {
+    var grandparent = { c: 3 };
+    var parent = Object.create(grandparent);
+    var obj;
+
+    parent.b = 2;
+    obj = Object.create(parent);
+    obj.a = 1;
+    print(obj.a, obj.b, obj.c, obj.d);
+}
+
+function shadowing() {
+    var parent = { b: 'parent-b' };
+    var obj = Object.create(parent);
+    obj.b = 'own-b';
+    print(obj.b);
+}
+
+function accessorInChain() {
+    var parent = {
+        get x() { print('getter this:', this === obj); return undefined; },
+        set y(v) { print('setter called:', v); }
+    };
+    var obj = Object.create(parent);
+
+    obj.x;
+    obj.y = 123;
+    print(obj.hasOwnProperty('y') ? 'own y' : obj.y);
+}
+
+function nonWritable() {
+    'use strict';
+    var obj = {};
+    Object.defineProperty(obj, 'x', { value: 1, writable: false, configurable: true });
+    try {
+        obj.x = 2;
+        print('never here');
+    } catch (e) {
+        print(e.name);
+    }
+    print(obj.x);
+}
+
+function inheritedNonWritable() {
+    'use strict';
+    var parent = {};
+    var obj;
+    Object.defineProperty(parent, 'x', { value: 1, writable: false });
+    obj = Object.create(parent);
+    try {
+        obj.x = 2;
+        print('never here');
+    } catch (e) {
+        print(e.name);
+    }
+    print(obj.hasOwnProperty('x'));
+}
+
+function frozen() {
+    'use strict';
+    var obj = Object.freeze({ x: 1 });
+    try {
+        obj.x = 2;
+        print('never here');
+    } catch (e) {
+        print(e.name);
+    }
+    print(obj.x);
+}
+
+function proxyObject() {
+    var target = { foo: 'proxied' };
+    var proxy = new Proxy(target, {
+        get: function (t, k, r) { print('get trap:', String(k)); return t[k]; },
+        set: function (t, k, v, r) { print('set trap:', String(k)); t[k] = v; return true; }
+    });
+
+    print(proxy.foo);
+    proxy.foo = 1;
+    print(target.foo);
+}
+
+function argumentsObject(a, b) {
+    print(arguments[0], b);
+    arguments[0] = 20;
+    print(a, arguments[1]);
+}
+
+function stringBase() {
+    var str = 'foobar';
+    print(typeof str.charAt('0'));
+    print(str.length, str.charAt(1));
+    String.prototype.myMethod = function () { return 'overridden: ' + this; };
+    print('xyz'.myMethod());
+    delete String.prototype.myMethod;
+}
+
+function symbolKey() {
+    var sym = Symbol('test');
+    var obj = {};
+    obj[sym] = 'symval';
+    print(obj[sym]);
+}
+
+function largeObject() {
+    var obj = {};
+    var i;
+    for (i = 0; i < 200; i++) {
+        obj['key' + i] = i;
+    }
+    print(obj.key199, obj.key200);
+}
+
+function deleteAndReadd() {
+    var obj = { a: 1, b: 2 };
+    delete obj.a;
+    print(obj.a, obj.b);
+}
+
+try {
+    print('own and inherited');
+    ownAndInherited();
+    print('shadowing');
+    shadowing();
+    print('accessor in chain');
+    accessorInChain();
+    print('non-writable');
+    nonWritable();
+    print('inherited non-writable');
+    inheritedNonWritable();
+    print('frozen');
+    frozen();
+    print('proxy');
+    proxyObject();
+    print('arguments');
+    argumentsObject(10, 11);
+    print('string base');
+    stringBase();
+    print('symbol key');
+    symbolKey();
+    print('large object');
+    largeObject();
+    print('delete and re-add');
+    deleteAndReadd();
+} catch (e) {
+    print(e.stack || e);
+}
@@ -0,0 +1,147 @@
+/*
+ *  Long strings built with repeated 'x += y' may be extended in place
+ *  (DUK_USE_HSTRING_APPEND).  Check that values shared with other
+ *  variables, property keys, and the pre-op value seen by the right hand
+ *  side are never affected, and that the results are ordinary interned
+ *  strings.
+ */
+
+/*===
+build ok 80000 80000
+alias ok
+self ok 2048
+rhs modifies lhs ok
+valueOf modifies lhs ok
+key ok true false
+interned ok true true
+non-ascii ok 3000 ä ö
+symbol TypeError
+done
+===*/
+
+function pad(n) {
+    var s = '';
+    while (s.length < n) {
+        s += 'abcdefghijklmnopqrstuvwxyz'.charAt(s.length % 26);
+    }
+    return s;
+}
+
+function buildTest() {
+    var s = '', parts = [], i, piece;
+
+    for (i = 0; i < 20000; i++) {
+        piece = '<' + (i % 10) + '/>';
+        s += piece;
+        parts.push(piece);
+    }
+    print('build ' + (s === parts.join('') ? 'ok' : 'fail'), s.length, parts.join('').length);
+}
+
+function aliasTest() {
+    var s = pad(1000), t, u, i;
+
+    t = s;
+    for (i = 0; i < 100; i++) {
+        s += 'x' + i;
+    }
+    u = s;
+    s += 'tail';
+    t = t + '';
+    print((t === pad(1000) && u.length === s.length - 4 && s.slice(0, u.length) === u) ? 'alias ok' : 'alias fail');
+}
+
+function selfTest() {
+    var s = pad(512);
+    s += s;
+    s += s;
+    print((s === pad(512) + pad(512) + pad(512) + pad(512)) ? 'self ok' : 'self fail', s.length);
+}
+
+function rhsTest() {
+    var s = pad(600), orig = s;
+
+    function f() {
+        s = 'replaced';
+        return 'y';
+    }
+    s += f();
+    print(s === orig + 'y' ? 'rhs modifies lhs ok' : 'rhs modifies lhs fail');
+}
+
+function valueOfTest() {
+    var s = pad(600), orig = s, i;
+    var obj = { valueOf: function () { s += 'inner'; return 'v'; } };
+
+    for (i = 0; i < 3; i++) {
+        s += 'z';
+    }
+    orig = s;
+    s += obj;
+    print(s === orig + 'v' ? 'valueOf modifies lhs ok' : 'valueOf modifies lhs fail');
+}
+
+function keyTest() {
+    var s = pad(700), o = {}, k, i;
+
+    for (i = 0; i < 10; i++) {
+        s += 'k';
+    }
+    o[s] = 1;
+    k = s;
+    s += 'more';
+    print('key ok', o[k] === 1, s in o);
+}
+
+function internTest() {
+    var a = pad(800), b = '', i, o = {};
+
+    for (i = 0; i < 100; i++) {
+        a += '.' + i;
+    }
+    b = pad(800);
+    for (i = 0; i < 100; i++) {
+        b = b + ('.' + i);
+    }
+    o[a] = true;
+    print('interned ok', a === b, o[b]);
+}
+
+function nonAsciiTest() {
+    var s = pad(1000), i;
+
+    for (i = 0; i < 1000; i++) {
+        s += (i & 1) ? 'ä' : 'ö';
+    }
+    for (i = 0; i < 1000; i++) {
+        s += '-';
+    }
+    print('non-ascii ok', s.length, s.charAt(1001), s.charAt(1000));
+}
+
+function symbolTest() {
+    var s = pad(1000);
+
+    try {
+        s += Symbol('foo');
+        print('no error');
+    } catch (e) {
+        print('symbol', e.name);
+    }
+}
+
+try {
+    buildTest();
+    aliasTest();
+    selfTest();
+    rhsTest();
+    valueOfTest();
+    keyTest();
+    internTest();
+    nonAsciiTest();
+    symbolTest();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
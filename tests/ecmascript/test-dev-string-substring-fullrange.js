@@ -0,0 +1,56 @@
+/*
+ *  Substring operations covering the whole input (and split() trailers
+ *  which do) return the input string without re-interning it.  Check
+ *  that results are still correct for various inputs and call styles.
+ */
+
+/*===
+abcdef abcdef abcdef abcdef
+äöü äöü äöü äöü
+[||]
+true true true
+abcdef,
+abc
+ä,b,c
+äöü
+,
+äöü|ab
+true
+done
+===*/
+
+function test() {
+    var s = 'abc' + 'def';
+    var u = 'äöü';
+    var e = '';
+    var big, pieces;
+
+    print(s.slice(0), s.substring(0, 100), s.substr(0), s.slice(-100, 100));
+    print(u.slice(0), u.substring(u.length, 0), u.substr(-3), u.slice(0, u.length));
+    print('[' + [ e.slice(0), e.substring(0), e.substr(0) ].join('|') + ']');
+
+    // Results are ordinary strings usable as keys and comparable.
+    var o = {};
+    o[s.slice(0)] = true;
+    print(o.abcdef, s.slice(0) === s, u.substring(0) === 'äöü');
+
+    // split() trailers.
+    print(String(s.split('x').concat([ '' ])));
+    print(String('abc'.split('x', 5)));
+    print(String('äbc'.split('')));
+    print(String(u.split(/x/)));
+    print(String(''.split('x').concat([ '' ])));
+    print([ u.split(/^/)[0], 'ab'.split(/(?:)/).join('') ].join('|'));
+
+    big = new Array(10001).join('x');
+    pieces = big.split('y');
+    print(pieces.length === 1 && pieces[0] === big && big.slice(0).length === 10000);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
@@ -0,0 +1,109 @@
+/*
+ *  Radix 10 string-to-number conversion uses a 64-bit fast path with a
+ *  Dragon4 fallback for inputs close to a rounding boundary.  Exercise
+ *  both, including denormals, overflow and underflow.
+ */
+
+/*===
+1.5
+0.1
+-0.30000000000000004
+123456789012345680
+9007199254740992
+9007199254740994
+9007199254740996
+5e-324
+0
+5e-324
+2.2250738585072014e-308
+2.225073858507201e-308
+1.7976931348623157e+308
+1.7976931348623157e+308
+Infinity
+0
+Infinity
+0
+0.001234
+1e-7
+123.456
+1.2345678901234568e+21
+1.2345678901234568e+28
+roundtrip ok
+literal ok
+json ok
+done
+===*/
+
+function basicTest() {
+    [ '1.5', '0.1', '-0.30000000000000004', '123456789012345678',
+      '9007199254740993', '9007199254740993.0001', '9007199254740995',
+      '4.9406564584124654e-324', '2.4703282292062327e-324', '2.4703282292062328e-324',
+      '2.2250738585072014e-308', '2.2250738585072011e-308',
+      '1.7976931348623157e308', '1.7976931348623158e308', '1.7976931348623159e308',
+      '1e-400', '1e400', '-0e5', '000.0001234e1', '1e-7', '123456e-3',
+      '1234567890123456789012', '12345678901234567890123456789'
+    ].forEach(function (s) {
+        print(String(Number(s)));
+    });
+}
+
+function roundtripTest() {
+    var dv = new DataView(new ArrayBuffer(8));
+    var seed = 42;
+    var i, x, s, bad = 0;
+
+    function rnd() {
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+        return seed;
+    }
+
+    for (i = 0; i < 20000; i++) {
+        dv.setUint32(0, ((rnd() << 1) ^ (rnd() >>> 3)) & 0x7fffffff);
+        dv.setUint32(4, ((rnd() << 1) ^ (rnd() >>> 3)) >>> 0);
+        x = dv.getFloat64(0);
+        if (!isFinite(x)) {
+            continue;
+        }
+        s = String(x);
+        if (Number(s) !== x || parseFloat(s) !== x || Number(x.toExponential(20)) !== x) {
+            print('failed:', s);
+            bad++;
+        }
+    }
+    print(bad === 0 ? 'roundtrip ok' : 'roundtrip fail');
+}
+
+function literalTest() {
+    // Numeric literals go through the same conversion.
+    var ok = (eval('0.1') === 0.1 && eval('1.5e300') === 1.5e300 &&
+              eval('3.14159') === Math.PI - 0.0000026535897931159976 &&
+              eval('6.02214076e23') === Number('6.02214076e23'));
+    print(ok ? 'literal ok' : 'literal fail');
+}
+
+function jsonTest() {
+    var arr = [], i, txt, res, bad = 0;
+
+    for (i = 0; i < 1000; i++) {
+        arr.push(Math.sin(i) * Math.pow(10, (i % 40) - 20));
+    }
+    txt = JSON.stringify(arr);
+    res = JSON.parse(txt);
+    for (i = 0; i < arr.length; i++) {
+        if (res[i] !== arr[i]) {
+            bad++;
+        }
+    }
+    print(bad === 0 ? 'json ok' : 'json fail');
+}
+
+try {
+    basicTest();
+    roundtripTest();
+    literalTest();
+    jsonTest();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
@@ -42,7 +42,10 @@ function wrappedTest(n) {
 
     try {
         src = createRegexp(n);
-        reg = new RegExp(src);
+
+        // The (empty) backreference prevents falling back to the Pike VM
+        // (DUK_USE_REGEXP_PIKEVM) which has no such limit.
+        reg = new RegExp('()\\1' + src);
         input = '';
         while (input.length < n) { input += 'y'; }
         reg.exec(input);
@@ -0,0 +1,122 @@
+/*
+ *  RegExps without backreferences or lookaheads are rematched with a Pike
+ *  VM when backtracking gets too expensive (DUK_USE_REGEXP_PIKEVM).  The
+ *  results (match, captures, index, lastIndex) must be the same as the
+ *  backtracking matcher would produce given unlimited time.
+ */
+
+/* Marked custom because without the Pike VM these fail with a RangeError
+ * (step or recursion limit).
+ */
+/*---
+{
+    "custom": true
+}
+---*/
+
+/*===
+empty loops
+["",null]
+["aaa","aaa"]
+["aab","a"]
+expensive
+nested true 30
+nested match 11 0
+alternation true 31
+alternation match 30
+recursion 20001 20000
+dotstar null
+dotstar match 1000 20000
+captures ["xyyyyyyyyyz","y","z"]
+minimal ["abbbbc"]
+global 10 b0,b1,b2
+split 1001
+replace 2000
+nonascii 2001 ä
+counted 5 true
+done
+===*/
+
+function show(m) {
+    return JSON.stringify(m === null ? null : Array.prototype.slice.call(m));
+}
+
+function repeat(s, n) {
+    return new Array(n + 1).join(s);
+}
+
+function emptyLoops() {
+    // An iteration matching the empty string ends the loop (E5 Section
+    // 15.10.2.5, RepeatMatcher step 2.b); the backtracking matcher does
+    // not implement this for complex atoms and runs into its recursion
+    // limit instead.
+    print('empty loops');
+    print(show(/(a*)*/.exec('b')));
+    print(show(/(a*)*/.exec('aaa')));
+    print(show(/(a|)*b/.exec('aab')));
+}
+
+function expensive() {
+    var re, m, s;
+
+    print('expensive');
+
+    // Classic exponential case: no match.
+    s = repeat('a', 30);
+    print('nested', /^(a+)+$/.test(s), s.length);
+    s = repeat('a', 30) + 'b';
+    print('nested', /^(a+)+b/.test(s) ? 'match' : 'no match', /(a+)+b/.exec('xx' + repeat('a', 10) + 'b')[0].length, /(a+)+b/.exec('xx' + repeat('a', 10) + 'b')[1].length - 10);
+
+    s = repeat('ab', 15) + 'a';
+    print('alternation', /^(?:a|ab|b)*$/.test(s), s.length);
+    m = /(?:a|b|ab)*c/.exec(repeat('ab', 15) + 'c');
+    print('alternation', m ? 'match' : 'no match', m[0].length - 1);
+
+    // Deep backtracking recursion: one level per iteration.
+    s = repeat('x', 20000) + 'y';
+    m = /(?:x|z)*y/.exec(s);
+    print('recursion', m[0].length, m.index + m[0].length - 1);
+
+    // Quadratic scan: every start position fails late.
+    s = repeat('a', 20000);
+    print('dotstar', show(/a.*b/.exec(s)));
+    s = repeat('a', 19000) + 'b' + repeat('c', 999);
+    m = /a.*b.*c$/.exec(s);
+    print('dotstar', m ? 'match' : 'no match', m[0].length - 19000, s.length);
+
+    // Captures are those of the highest priority path.
+    s = 'x' + repeat('y', 9) + 'z';
+    print('captures', show(/x(y|yy)*(z)/.exec(s + repeat('y', 5000) + 'q')));
+
+    print('minimal', show(/ab+?c/.exec(repeat('a', 5000) + 'abbbbc')));
+
+    // Global regexp and lastIndex.
+    s = repeat('a', 3000);
+    re = /(?:a|aa)*(b\d)/g;
+    s = repeat('a', 30) + 'b0' + repeat('a', 30) + 'b1' + repeat('a', 30) + 'b2' + repeat('a', 30);
+    var found = [];
+    while ((m = re.exec(s)) !== null) {
+        found.push(m[1]);
+    }
+    print('global', re.lastIndex + 10, found.join(','));
+
+    print('split', (repeat('ab,', 1000) + 'x').split(/(?:a|ab|b)*,/).length);
+    print('replace', repeat('xy', 1000).replace(/(?:x|y)/g, 'zz').length / 2);
+
+    s = repeat('ä', 2000) + 'ö';
+    m = /(?:ä|ää)*ö/.exec('b' + s);
+    print('nonascii', m[0].length, m[0].charAt(0));
+
+    s = repeat('1', 3000);
+    m = /(?:1|11)*2|\d{5}$/.exec(s);
+    print('counted', m[0].length, m.index === 2995);
+}
+
+try {
+    emptyLoops();
+    expensive();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
@@ -0,0 +1,28 @@
+/*
+ *  Opcode dispatch: tight loop of cheap arithmetic/bitwise opcodes where
+ *  dispatch overhead dominates.
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var i;
+    var a = 1, b = 2, c = 3, d = 0;
+
+    for (i = 0; i < 2e7; i++) {
+        a = (a + b) | 0;
+        b = (b ^ c) + 1;
+        c = (a & 0xff) - (b >> 3);
+        d = d + (a < b ? 1 : 2);
+        a = a * 3 % 1000;
+    }
+
+    if (typeof d !== 'number') { throw new Error(); }
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
@@ -0,0 +1,41 @@
+/*
+ *  Opcode dispatch: loop with data dependent branches and a variety of
+ *  opcodes (compare, jump, load constant/boolean, typeof, increment).
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var i, j;
+    var x, cnt = 0, flag = false;
+    var str = 'foo';
+
+    for (i = 0; i < 5e6; i++) {
+        x = i & 7;
+        if (x === 0) {
+            cnt++;
+        } else if (x === 1) {
+            flag = !flag;
+        } else if (x < 4) {
+            cnt += 2;
+        } else if (typeof str === 'string') {
+            cnt--;
+        }
+        for (j = 0; j < 3; j++) {
+            if (flag) {
+                cnt++;
+            } else {
+                cnt--;
+            }
+        }
+    }
+
+    if (typeof cnt !== 'number') { throw new Error(); }
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
@@ -422,6 +422,7 @@ def main():
         'duk_bi_function.c',
         'duk_bi_global.c',
         'duk_bi_json.c',
+        'duk_bi_map.c',
         'duk_bi_math.c',
         'duk_bi_number.c',
         'duk_bi_object.c',
@@ -472,6 +473,7 @@ def main():
         'duk_heap_refcount.c',
         'duk_heap_stringcache.c',
         'duk_heap_stringtable.c',
+        'duk_hmap.h',
         'duk_hnatfunc.h',
         'duk_hobject_alloc.c',
         'duk_hobject_assert.c',
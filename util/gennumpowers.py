@@ -0,0 +1,43 @@
+#!/usr/bin/env python2
+#
+#  Generate the table of cached powers of ten used by the Grisu3
+#  number-to-string fast path (duk__cached_powers in duk_numconv.c).
+#
+#  Each entry is 10^k approximated as f * 2^e where f is a normalized
+#  64-bit significand (top bit set) rounded to nearest.  The decimal
+#  exponent step must be small enough that a power scaling any double
+#  into the [alpha,gamma] = [-60,-32] binary exponent range exists.
+#
+
+k_min = -348
+k_max = 340
+k_step = 8
+
+for k in xrange(k_min, k_max + 1, k_step):
+    # Exact 10^k as a rational num / den.
+    if k >= 0:
+        num, den = 10 ** k, 1
+    else:
+        num, den = 1, 10 ** (-k)
+
+    # Find e such that 2^63 <= 10^k / 2^e < 2^64.
+    e = num.bit_length() - den.bit_length() - 64
+    while True:
+        if e >= 0:
+            n, d = num, den << e
+        else:
+            n, d = num << (-e), den
+        if n >= d << 64:
+            e += 1
+        elif n < d << 63:
+            e -= 1
+        else:
+            break
+
+    # Round to nearest.
+    f = (2 * n + d) // (2 * d)
+    if f == 1 << 64:
+        f = f >> 1
+        e += 1
+
+    print('\t{ DUK_U64_CONSTANT(0x%016x), %d, %d },' % (f, e, k))